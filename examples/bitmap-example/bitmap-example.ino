@@ -0,0 +1,46 @@
+#define PANEL_BIG 1
+#include "HUB75nano.h"
+
+// create an instance of the panel
+Panel panel = {};
+
+// 1 bit mask, one byte per row of 8 pixels, the leftmost pixel is the most significant bit
+const uint8_t heart[8] PROGMEM = {
+    0b01100110,
+    0b11111111,
+    0b11111111,
+    0b11111111,
+    0b01111110,
+    0b00111100,
+    0b00011000,
+    0b00000000,
+};
+
+// 2 bits per pixel, index into the palette below, 2 bytes per row of 8 pixels
+const uint8_t smiley[16] PROGMEM = {
+    0b00000101, 0b01010000, // ..YYYY..
+    0b00010101, 0b01010100, // .YYYYYY.
+    0b01011001, 0b01100101, // YYKYYKYY
+    0b01010101, 0b01010101, // YYYYYYYY
+    0b01100101, 0b01011001, // YKYYYYKY
+    0b01011010, 0b10100101, // YYKKKKYY
+    0b00010111, 0b11010100, // .YYRRYY.
+    0b00000101, 0b01010000, // ..YYYY..
+};
+// index 0 is transparent
+const Color smiley_palette[4] = {Colors::NO_COLOR, Colors::YELLOW, Colors::BLACK, Colors::RED};
+
+void setup()
+{
+    panel.fillBuffer(Colors::DARKBLUE); // background
+
+    panel.drawBitmap(2, 2, 8, 8, heart, Colors::RED);                  // transparent background
+    panel.drawBitmap(14, 2, 8, 8, heart, Colors::WHITE, Colors::BLACK); // with a background
+    panel.drawIndexedBitmap(26, 2, 8, 8, smiley, 2, smiley_palette);
+    panel.drawIndexedBitmap(60, 20, 8, 8, smiley, 2, smiley_palette); // clipped at the right edge
+}
+
+void loop()
+{
+    panel.displayBuffer(); // makes the buffer visible and the leds all blinky blinky
+}
@@ -0,0 +1,155 @@
+#define PANEL_MAX_SPEED
+#define PANEL_FLASH_RLE // run length encoded 4 bit flash buffer, the frames share their unchanged rows
+#define MAX_FRAMETIME 63
+#define PANEL_X 64
+#define PANEL_Y 32
+#include "HUB75nano.h"
+
+// a ball rolling over a meadow, 16 frames of 4096 bytes converted with extras/flash-rle: ./flash-rle 64 32 80 < frames.ino
+// every frame is an offset table, the rows without the ball point at the ones of the first frame
+const unsigned char animation[3594] PROGMEM = {
+    0, 8, 0, 8, 2, 8, 7, 8, 7, 8, 13, 8, 7, 8, 7, 8, 19, 8, 24, 8, 24, 8, 24, 8, 26, 8, 26, 8, 28, 8, 28, 8,
+    26, 8, 26, 8, 30, 8, 35, 8, 35, 8, 41, 8, 35, 8, 35, 8, 47, 8, 28, 8, 28, 8, 28, 8, 52, 8, 52, 8, 24, 8, 24, 8,
+    52, 8, 52, 8, 54, 8, 59, 8, 59, 8, 65, 8, 71, 8, 71, 8, 77, 8, 28, 8, 28, 8, 28, 8, 82, 8, 82, 8, 84, 8, 84, 8,
+    0, 8, 0, 8, 86, 8, 91, 8, 91, 8, 97, 8, 103, 8, 103, 8, 109, 8, 111, 8, 111, 8, 113, 8, 115, 8, 115, 8, 117, 8, 119, 8,
+    128, 7, 128, 7, 249, 7, 254, 7, 254, 7, 4, 8, 254, 7, 254, 7, 10, 8, 152, 7, 152, 7, 152, 7, 154, 7, 154, 7, 156, 7, 156, 7,
+    154, 7, 154, 7, 15, 8, 20, 8, 20, 8, 26, 8, 20, 8, 20, 8, 32, 8, 156, 7, 156, 7, 156, 7, 180, 7, 180, 7, 152, 7, 152, 7,
+    180, 7, 180, 7, 37, 8, 42, 8, 42, 8, 48, 8, 54, 8, 54, 8, 60, 8, 156, 7, 156, 7, 156, 7, 210, 7, 210, 7, 212, 7, 212, 7,
+    128, 7, 128, 7, 65, 8, 70, 8, 70, 8, 76, 8, 82, 8, 82, 8, 237, 7, 239, 7, 239, 7, 241, 7, 243, 7, 243, 7, 245, 7, 247, 7,
+    0, 7, 0, 7, 216, 7, 221, 7, 221, 7, 227, 7, 221, 7, 221, 7, 233, 7, 24, 7, 24, 7, 24, 7, 26, 7, 26, 7, 28, 7, 28, 7,
+    26, 7, 26, 7, 238, 7, 243, 7, 243, 7, 249, 7, 243, 7, 243, 7, 255, 7, 28, 7, 28, 7, 28, 7, 52, 7, 52, 7, 24, 7, 24, 7,
+    52, 7, 52, 7, 4, 8, 9, 8, 9, 8, 15, 8, 21, 8, 21, 8, 27, 8, 28, 7, 28, 7, 28, 7, 82, 7, 82, 7, 84, 7, 84, 7,
+    0, 7, 0, 7, 32, 8, 37, 8, 37, 8, 43, 8, 49, 8, 49, 8, 109, 7, 111, 7, 111, 7, 113, 7, 115, 7, 115, 7, 117, 7, 119, 7,
+    128, 6, 128, 6, 183, 7, 188, 7, 188, 7, 194, 7, 188, 7, 188, 7, 200, 7, 152, 6, 152, 6, 152, 6, 154, 6, 154, 6, 156, 6, 156, 6,
+    154, 6, 154, 6, 205, 7, 210, 7, 210, 7, 216, 7, 210, 7, 210, 7, 222, 7, 156, 6, 156, 6, 156, 6, 180, 6, 180, 6, 152, 6, 152, 6,
+    180, 6, 180, 6, 227, 7, 232, 7, 232, 7, 238, 7, 244, 7, 244, 7, 250, 7, 156, 6, 156, 6, 156, 6, 210, 6, 210, 6, 212, 6, 212, 6,
+    128, 6, 128, 6, 255, 7, 4, 8, 4, 8, 10, 8, 16, 8, 16, 8, 237, 6, 239, 6, 239, 6, 241, 6, 243, 6, 243, 6, 245, 6, 247, 6,
+    0, 6, 0, 6, 150, 7, 155, 7, 155, 7, 161, 7, 155, 7, 155, 7, 167, 7, 24, 6, 24, 6, 24, 6, 26, 6, 26, 6, 28, 6, 28, 6,
+    26, 6, 26, 6, 172, 7, 177, 7, 177, 7, 183, 7, 177, 7, 177, 7, 189, 7, 28, 6, 28, 6, 28, 6, 52, 6, 52, 6, 24, 6, 24, 6,
+    52, 6, 52, 6, 194, 7, 199, 7, 199, 7, 205, 7, 211, 7, 211, 7, 217, 7, 28, 6, 28, 6, 28, 6, 82, 6, 82, 6, 84, 6, 84, 6,
+    0, 6, 0, 6, 222, 7, 227, 7, 227, 7, 233, 7, 239, 7, 239, 7, 109, 6, 111, 6, 111, 6, 113, 6, 115, 6, 115, 6, 117, 6, 119, 6,
+    128, 5, 128, 5, 117, 7, 122, 7, 122, 7, 128, 7, 122, 7, 122, 7, 134, 7, 152, 5, 152, 5, 152, 5, 154, 5, 154, 5, 156, 5, 156, 5,
+    154, 5, 154, 5, 139, 7, 144, 7, 144, 7, 150, 7, 144, 7, 144, 7, 156, 7, 156, 5, 156, 5, 156, 5, 180, 5, 180, 5, 152, 5, 152, 5,
+    180, 5, 180, 5, 161, 7, 166, 7, 166, 7, 172, 7, 178, 7, 178, 7, 184, 7, 156, 5, 156, 5, 156, 5, 210, 5, 210, 5, 212, 5, 212, 5,
+    128, 5, 128, 5, 189, 7, 194, 7, 194, 7, 200, 7, 206, 7, 206, 7, 237, 5, 239, 5, 239, 5, 241, 5, 243, 5, 243, 5, 245, 5, 247, 5,
+    0, 5, 0, 5, 84, 7, 89, 7, 89, 7, 95, 7, 89, 7, 89, 7, 101, 7, 24, 5, 24, 5, 24, 5, 26, 5, 26, 5, 28, 5, 28, 5,
+    26, 5, 26, 5, 106, 7, 111, 7, 111, 7, 117, 7, 111, 7, 111, 7, 123, 7, 28, 5, 28, 5, 28, 5, 52, 5, 52, 5, 24, 5, 24, 5,
+    52, 5, 52, 5, 128, 7, 133, 7, 133, 7, 139, 7, 145, 7, 145, 7, 151, 7, 28, 5, 28, 5, 28, 5, 82, 5, 82, 5, 84, 5, 84, 5,
+    0, 5, 0, 5, 156, 7, 161, 7, 161, 7, 167, 7, 173, 7, 173, 7, 109, 5, 111, 5, 111, 5, 113, 5, 115, 5, 115, 5, 117, 5, 119, 5,
+    128, 4, 128, 4, 51, 7, 56, 7, 56, 7, 62, 7, 56, 7, 56, 7, 68, 7, 152, 4, 152, 4, 152, 4, 154, 4, 154, 4, 156, 4, 156, 4,
+    154, 4, 154, 4, 73, 7, 78, 7, 78, 7, 84, 7, 78, 7, 78, 7, 90, 7, 156, 4, 156, 4, 156, 4, 180, 4, 180, 4, 152, 4, 152, 4,
+    180, 4, 180, 4, 95, 7, 100, 7, 100, 7, 106, 7, 112, 7, 112, 7, 118, 7, 156, 4, 156, 4, 156, 4, 210, 4, 210, 4, 212, 4, 212, 4,
+    128, 4, 128, 4, 123, 7, 128, 7, 128, 7, 134, 7, 140, 7, 140, 7, 237, 4, 239, 4, 239, 4, 241, 4, 243, 4, 243, 4, 245, 4, 247, 4,
+    0, 4, 0, 4, 18, 7, 23, 7, 23, 7, 29, 7, 23, 7, 23, 7, 35, 7, 24, 4, 24, 4, 24, 4, 26, 4, 26, 4, 28, 4, 28, 4,
+    26, 4, 26, 4, 40, 7, 45, 7, 45, 7, 51, 7, 45, 7, 45, 7, 57, 7, 28, 4, 28, 4, 28, 4, 52, 4, 52, 4, 24, 4, 24, 4,
+    52, 4, 52, 4, 62, 7, 67, 7, 67, 7, 73, 7, 79, 7, 79, 7, 85, 7, 28, 4, 28, 4, 28, 4, 82, 4, 82, 4, 84, 4, 84, 4,
+    0, 4, 0, 4, 90, 7, 95, 7, 95, 7, 101, 7, 107, 7, 107, 7, 109, 4, 111, 4, 111, 4, 113, 4, 115, 4, 115, 4, 117, 4, 119, 4,
+    128, 3, 128, 3, 241, 6, 246, 6, 246, 6, 252, 6, 246, 6, 246, 6, 2, 7, 152, 3, 152, 3, 152, 3, 154, 3, 154, 3, 156, 3, 156, 3,
+    154, 3, 154, 3, 7, 7, 12, 7, 12, 7, 18, 7, 12, 7, 12, 7, 24, 7, 156, 3, 156, 3, 156, 3, 180, 3, 180, 3, 152, 3, 152, 3,
+    180, 3, 180, 3, 29, 7, 34, 7, 34, 7, 40, 7, 46, 7, 46, 7, 52, 7, 156, 3, 156, 3, 156, 3, 210, 3, 210, 3, 212, 3, 212, 3,
+    128, 3, 128, 3, 57, 7, 62, 7, 62, 7, 68, 7, 74, 7, 74, 7, 237, 3, 239, 3, 239, 3, 241, 3, 243, 3, 243, 3, 245, 3, 247, 3,
+    0, 3, 0, 3, 208, 6, 213, 6, 213, 6, 219, 6, 213, 6, 213, 6, 225, 6, 24, 3, 24, 3, 24, 3, 26, 3, 26, 3, 28, 3, 28, 3,
+    26, 3, 26, 3, 230, 6, 235, 6, 235, 6, 241, 6, 235, 6, 235, 6, 247, 6, 28, 3, 28, 3, 28, 3, 52, 3, 52, 3, 24, 3, 24, 3,
+    52, 3, 52, 3, 252, 6, 1, 7, 1, 7, 7, 7, 13, 7, 13, 7, 19, 7, 28, 3, 28, 3, 28, 3, 82, 3, 82, 3, 84, 3, 84, 3,
+    0, 3, 0, 3, 24, 7, 29, 7, 29, 7, 35, 7, 41, 7, 41, 7, 109, 3, 111, 3, 111, 3, 113, 3, 115, 3, 115, 3, 117, 3, 119, 3,
+    128, 2, 128, 2, 175, 6, 180, 6, 180, 6, 186, 6, 180, 6, 180, 6, 192, 6, 152, 2, 152, 2, 152, 2, 154, 2, 154, 2, 156, 2, 156, 2,
+    154, 2, 154, 2, 197, 6, 202, 6, 202, 6, 208, 6, 202, 6, 202, 6, 214, 6, 156, 2, 156, 2, 156, 2, 180, 2, 180, 2, 152, 2, 152, 2,
+    180, 2, 180, 2, 219, 6, 224, 6, 224, 6, 230, 6, 236, 6, 236, 6, 242, 6, 156, 2, 156, 2, 156, 2, 210, 2, 210, 2, 212, 2, 212, 2,
+    128, 2, 128, 2, 247, 6, 252, 6, 252, 6, 2, 7, 8, 7, 8, 7, 237, 2, 239, 2, 239, 2, 241, 2, 243, 2, 243, 2, 245, 2, 247, 2,
+    0, 2, 0, 2, 142, 6, 147, 6, 147, 6, 153, 6, 147, 6, 147, 6, 159, 6, 24, 2, 24, 2, 24, 2, 26, 2, 26, 2, 28, 2, 28, 2,
+    26, 2, 26, 2, 164, 6, 169, 6, 169, 6, 175, 6, 169, 6, 169, 6, 181, 6, 28, 2, 28, 2, 28, 2, 52, 2, 52, 2, 24, 2, 24, 2,
+    52, 2, 52, 2, 186, 6, 191, 6, 191, 6, 197, 6, 203, 6, 203, 6, 209, 6, 28, 2, 28, 2, 28, 2, 82, 2, 82, 2, 84, 2, 84, 2,
+    0, 2, 0, 2, 214, 6, 219, 6, 219, 6, 225, 6, 231, 6, 231, 6, 109, 2, 111, 2, 111, 2, 113, 2, 115, 2, 115, 2, 117, 2, 119, 2,
+    128, 1, 128, 1, 109, 6, 114, 6, 114, 6, 120, 6, 114, 6, 114, 6, 126, 6, 152, 1, 152, 1, 152, 1, 154, 1, 154, 1, 156, 1, 156, 1,
+    154, 1, 154, 1, 131, 6, 136, 6, 136, 6, 142, 6, 136, 6, 136, 6, 148, 6, 156, 1, 156, 1, 156, 1, 180, 1, 180, 1, 152, 1, 152, 1,
+    180, 1, 180, 1, 153, 6, 158, 6, 158, 6, 164, 6, 170, 6, 170, 6, 176, 6, 156, 1, 156, 1, 156, 1, 210, 1, 210, 1, 212, 1, 212, 1,
+    128, 1, 128, 1, 181, 6, 186, 6, 186, 6, 192, 6, 198, 6, 198, 6, 237, 1, 239, 1, 239, 1, 241, 1, 243, 1, 243, 1, 245, 1, 247, 1,
+    0, 1, 0, 1, 76, 6, 81, 6, 81, 6, 87, 6, 81, 6, 81, 6, 93, 6, 24, 1, 24, 1, 24, 1, 26, 1, 26, 1, 28, 1, 28, 1,
+    26, 1, 26, 1, 98, 6, 103, 6, 103, 6, 109, 6, 103, 6, 103, 6, 115, 6, 28, 1, 28, 1, 28, 1, 52, 1, 52, 1, 24, 1, 24, 1,
+    52, 1, 52, 1, 120, 6, 125, 6, 125, 6, 131, 6, 137, 6, 137, 6, 143, 6, 28, 1, 28, 1, 28, 1, 82, 1, 82, 1, 84, 1, 84, 1,
+    0, 1, 0, 1, 148, 6, 153, 6, 153, 6, 159, 6, 165, 6, 165, 6, 109, 1, 111, 1, 111, 1, 113, 1, 115, 1, 115, 1, 117, 1, 119, 1,
+    128, 0, 128, 0, 43, 6, 48, 6, 48, 6, 54, 6, 48, 6, 48, 6, 60, 6, 152, 0, 152, 0, 152, 0, 154, 0, 154, 0, 156, 0, 156, 0,
+    154, 0, 154, 0, 65, 6, 70, 6, 70, 6, 76, 6, 70, 6, 70, 6, 82, 6, 156, 0, 156, 0, 156, 0, 180, 0, 180, 0, 152, 0, 152, 0,
+    180, 0, 180, 0, 87, 6, 92, 6, 92, 6, 98, 6, 104, 6, 104, 6, 110, 6, 156, 0, 156, 0, 156, 0, 210, 0, 210, 0, 212, 0, 212, 0,
+    128, 0, 128, 0, 115, 6, 120, 6, 120, 6, 126, 6, 132, 6, 132, 6, 237, 0, 239, 0, 239, 0, 241, 0, 243, 0, 243, 0, 245, 0, 247, 0,
+    126, 32, 69, 32, 24, 118, 32, 67, 32, 67, 24, 116, 32, 66, 32, 69, 24, 115, 32, 69, 0, 24, 118, 0, 126, 0, 126, 4, 126, 20, 69, 4,
+    28, 118, 4, 67, 4, 67, 28, 116, 4, 66, 4, 69, 28, 115, 4, 69, 20, 28, 118, 20, 126, 16, 69, 48, 8, 118, 48, 67, 48, 67, 8, 116,
+    48, 66, 48, 69, 8, 115, 48, 67, 52, 67, 12, 116, 52, 69, 20, 12, 118, 20, 126, 18, 126, 2, 69, 16, 8, 118, 16, 67, 20, 67, 12, 116,
+    20, 66, 52, 69, 12, 115, 52, 67, 50, 67, 10, 116, 50, 126, 10, 126, 14, 126, 30, 126, 24, 126, 8, 126, 12, 72, 32, 24, 115, 32, 70, 32,
+    67, 24, 113, 32, 69, 32, 69, 24, 112, 32, 72, 0, 24, 115, 0, 72, 4, 28, 115, 4, 70, 4, 67, 28, 113, 4, 69, 4, 69, 28, 112, 4,
+    72, 20, 28, 115, 20, 72, 48, 8, 115, 48, 70, 48, 67, 8, 113, 48, 69, 48, 69, 8, 112, 48, 70, 52, 67, 12, 113, 52, 72, 20, 12, 115,
+    20, 72, 16, 8, 115, 16, 70, 20, 67, 12, 113, 20, 69, 52, 69, 12, 112, 52, 70, 50, 67, 10, 113, 50, 75, 32, 24, 112, 32, 73, 32, 67,
+    24, 110, 32, 72, 32, 69, 24, 109, 32, 75, 0, 24, 112, 0, 75, 4, 28, 112, 4, 73, 4, 67, 28, 110, 4, 72, 4, 69, 28, 109, 4, 75,
+    20, 28, 112, 20, 75, 48, 8, 112, 48, 73, 48, 67, 8, 110, 48, 72, 48, 69, 8, 109, 48, 73, 52, 67, 12, 110, 52, 75, 20, 12, 112, 20,
+    75, 16, 8, 112, 16, 73, 20, 67, 12, 110, 20, 72, 52, 69, 12, 109, 52, 73, 50, 67, 10, 110, 50, 78, 32, 24, 109, 32, 76, 32, 67, 24,
+    107, 32, 75, 32, 69, 24, 106, 32, 78, 0, 24, 109, 0, 78, 4, 28, 109, 4, 76, 4, 67, 28, 107, 4, 75, 4, 69, 28, 106, 4, 78, 20,
+    28, 109, 20, 78, 48, 8, 109, 48, 76, 48, 67, 8, 107, 48, 75, 48, 69, 8, 106, 48, 76, 52, 67, 12, 107, 52, 78, 20, 12, 109, 20, 78,
+    16, 8, 109, 16, 76, 20, 67, 12, 107, 20, 75, 52, 69, 12, 106, 52, 76, 50, 67, 10, 107, 50, 81, 32, 24, 106, 32, 79, 32, 67, 24, 104,
+    32, 78, 32, 69, 24, 103, 32, 81, 0, 24, 106, 0, 81, 4, 28, 106, 4, 79, 4, 67, 28, 104, 4, 78, 4, 69, 28, 103, 4, 81, 20, 28,
+    106, 20, 81, 48, 8, 106, 48, 79, 48, 67, 8, 104, 48, 78, 48, 69, 8, 103, 48, 79, 52, 67, 12, 104, 52, 81, 20, 12, 106, 20, 81, 16,
+    8, 106, 16, 79, 20, 67, 12, 104, 20, 78, 52, 69, 12, 103, 52, 79, 50, 67, 10, 104, 50, 84, 32, 24, 103, 32, 82, 32, 67, 24, 101, 32,
+    81, 32, 69, 24, 100, 32, 84, 0, 24, 103, 0, 84, 4, 28, 103, 4, 82, 4, 67, 28, 101, 4, 81, 4, 69, 28, 100, 4, 84, 20, 28, 103,
+    20, 84, 48, 8, 103, 48, 82, 48, 67, 8, 101, 48, 81, 48, 69, 8, 100, 48, 82, 52, 67, 12, 101, 52, 84, 20, 12, 103, 20, 84, 16, 8,
+    103, 16, 82, 20, 67, 12, 101, 20, 81, 52, 69, 12, 100, 52, 82, 50, 67, 10, 101, 50, 87, 32, 24, 100, 32, 85, 32, 67, 24, 98, 32, 84,
+    32, 69, 24, 97, 32, 87, 0, 24, 100, 0, 87, 4, 28, 100, 4, 85, 4, 67, 28, 98, 4, 84, 4, 69, 28, 97, 4, 87, 20, 28, 100, 20,
+    87, 48, 8, 100, 48, 85, 48, 67, 8, 98, 48, 84, 48, 69, 8, 97, 48, 85, 52, 67, 12, 98, 52, 87, 20, 12, 100, 20, 87, 16, 8, 100,
+    16, 85, 20, 67, 12, 98, 20, 84, 52, 69, 12, 97, 52, 85, 50, 67, 10, 98, 50, 90, 32, 24, 97, 32, 88, 32, 67, 24, 95, 32, 87, 32,
+    69, 24, 94, 32, 90, 0, 24, 97, 0, 90, 4, 28, 97, 4, 88, 4, 67, 28, 95, 4, 87, 4, 69, 28, 94, 4, 90, 20, 28, 97, 20, 90,
+    48, 8, 97, 48, 88, 48, 67, 8, 95, 48, 87, 48, 69, 8, 94, 48, 88, 52, 67, 12, 95, 52, 90, 20, 12, 97, 20, 90, 16, 8, 97, 16,
+    88, 20, 67, 12, 95, 20, 87, 52, 69, 12, 94, 52, 88, 50, 67, 10, 95, 50, 93, 32, 24, 94, 32, 91, 32, 67, 24, 92, 32, 90, 32, 69,
+    24, 91, 32, 93, 0, 24, 94, 0, 93, 4, 28, 94, 4, 91, 4, 67, 28, 92, 4, 90, 4, 69, 28, 91, 4, 93, 20, 28, 94, 20, 93, 48,
+    8, 94, 48, 91, 48, 67, 8, 92, 48, 90, 48, 69, 8, 91, 48, 91, 52, 67, 12, 92, 52, 93, 20, 12, 94, 20, 93, 16, 8, 94, 16, 91,
+    20, 67, 12, 92, 20, 90, 52, 69, 12, 91, 52, 91, 50, 67, 10, 92, 50, 96, 32, 24, 91, 32, 94, 32, 67, 24, 89, 32, 93, 32, 69, 24,
+    88, 32, 96, 0, 24, 91, 0, 96, 4, 28, 91, 4, 94, 4, 67, 28, 89, 4, 93, 4, 69, 28, 88, 4, 96, 20, 28, 91, 20, 96, 48, 8,
+    91, 48, 94, 48, 67, 8, 89, 48, 93, 48, 69, 8, 88, 48, 94, 52, 67, 12, 89, 52, 96, 20, 12, 91, 20, 96, 16, 8, 91, 16, 94, 20,
+    67, 12, 89, 20, 93, 52, 69, 12, 88, 52, 94, 50, 67, 10, 89, 50, 99, 32, 24, 88, 32, 97, 32, 67, 24, 86, 32, 96, 32, 69, 24, 85,
+    32, 99, 0, 24, 88, 0, 99, 4, 28, 88, 4, 97, 4, 67, 28, 86, 4, 96, 4, 69, 28, 85, 4, 99, 20, 28, 88, 20, 99, 48, 8, 88,
+    48, 97, 48, 67, 8, 86, 48, 96, 48, 69, 8, 85, 48, 97, 52, 67, 12, 86, 52, 99, 20, 12, 88, 20, 99, 16, 8, 88, 16, 97, 20, 67,
+    12, 86, 20, 96, 52, 69, 12, 85, 52, 97, 50, 67, 10, 86, 50, 102, 32, 24, 85, 32, 100, 32, 67, 24, 83, 32, 99, 32, 69, 24, 82, 32,
+    102, 0, 24, 85, 0, 102, 4, 28, 85, 4, 100, 4, 67, 28, 83, 4, 99, 4, 69, 28, 82, 4, 102, 20, 28, 85, 20, 102, 48, 8, 85, 48,
+    100, 48, 67, 8, 83, 48, 99, 48, 69, 8, 82, 48, 100, 52, 67, 12, 83, 52, 102, 20, 12, 85, 20, 102, 16, 8, 85, 16, 100, 20, 67, 12,
+    83, 20, 99, 52, 69, 12, 82, 52, 100, 50, 67, 10, 83, 50, 105, 32, 24, 82, 32, 103, 32, 67, 24, 80, 32, 102, 32, 69, 24, 79, 32, 105,
+    0, 24, 82, 0, 105, 4, 28, 82, 4, 103, 4, 67, 28, 80, 4, 102, 4, 69, 28, 79, 4, 105, 20, 28, 82, 20, 105, 48, 8, 82, 48, 103,
+    48, 67, 8, 80, 48, 102, 48, 69, 8, 79, 48, 103, 52, 67, 12, 80, 52, 105, 20, 12, 82, 20, 105, 16, 8, 82, 16, 103, 20, 67, 12, 80,
+    20, 102, 52, 69, 12, 79, 52, 103, 50, 67, 10, 80, 50, 108, 32, 24, 79, 32, 106, 32, 67, 24, 77, 32, 105, 32, 69, 24, 76, 32, 108, 0,
+    24, 79, 0, 108, 4, 28, 79, 4, 106, 4, 67, 28, 77, 4, 105, 4, 69, 28, 76, 4, 108, 20, 28, 79, 20, 108, 48, 8, 79, 48, 106, 48,
+    67, 8, 77, 48, 105, 48, 69, 8, 76, 48, 106, 52, 67, 12, 77, 52, 108, 20, 12, 79, 20, 108, 16, 8, 79, 16, 106, 20, 67, 12, 77, 20,
+    105, 52, 69, 12, 76, 52, 106, 50, 67, 10, 77, 50, 111, 32, 24, 76, 32, 109, 32, 67, 24, 74, 32, 108, 32, 69, 24, 73, 32, 111, 0, 24,
+    76, 0, 111, 4, 28, 76, 4, 109, 4, 67, 28, 74, 4, 108, 4, 69, 28, 73, 4, 111, 20, 28, 76, 20, 111, 48, 8, 76, 48, 109, 48, 67,
+    8, 74, 48, 108, 48, 69, 8, 73, 48, 109, 52, 67, 12, 74, 52, 111, 20, 12, 76, 20, 111, 16, 8, 76, 16, 109, 20, 67, 12, 74, 20, 108,
+    52, 69, 12, 73, 52, 109, 50, 67, 10, 74, 50, 114, 32, 24, 73, 32, 112, 32, 67, 24, 71, 32, 111, 32, 69, 24, 70, 32, 114, 0, 24, 73,
+    0, 114, 4, 28, 73, 4, 112, 4, 67, 28, 71, 4, 111, 4, 69, 28, 70, 4, 114, 20, 28, 73, 20, 114, 48, 8, 73, 48, 112, 48, 67, 8,
+    71, 48, 111, 48, 69, 8, 70, 48, 112, 52, 67, 12, 71, 52, 114, 20, 12, 73, 20, 114, 16, 8, 73, 16, 112, 20, 67, 12, 71, 20, 111, 52,
+    69, 12, 70, 52, 112, 50, 67, 10, 71, 50,
+};
+const AnimationFrame frames[16] PROGMEM = {
+    {animation + 0, 80},
+    {animation + 128, 80},
+    {animation + 256, 80},
+    {animation + 384, 80},
+    {animation + 512, 80},
+    {animation + 640, 80},
+    {animation + 768, 80},
+    {animation + 896, 80},
+    {animation + 1024, 80},
+    {animation + 1152, 80},
+    {animation + 1280, 80},
+    {animation + 1408, 80},
+    {animation + 1536, 80},
+    {animation + 1664, 80},
+    {animation + 1792, 80},
+    {animation + 1920, 80},
+};
+
+// the first frame is shown until playAnimation() takes over
+Panel panel(animation);
+void setup()
+{
+    // loops forever, frames change between two refreshes once their 80 ms are over
+    panel.playAnimation(frames, 16);
+}
+
+void loop()
+{
+    panel.displayBuffer();
+}
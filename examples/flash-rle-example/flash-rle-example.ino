@@ -0,0 +1,137 @@
+#define PANEL_MAX_SPEED
+#define PANEL_FLASH_RLE // run length encoded 4 bit flash buffer
+#define MAX_FRAMETIME 63
+#define PANEL_X 64
+#define PANEL_Y 32
+#include "HUB75nano.h"
+
+// the image of flash-example, converted with extras/flash-rle: ./flash-rle < flash-example.ino
+// an offset for every row of every pass, then the rows as single pixels and runs, still in PROGMEM
+const unsigned char buffer[3673] PROGMEM = {
+    128, 0, 175, 0, 234, 0, 24, 1, 62, 1, 99, 1, 144, 1, 187, 1, 225, 1, 3, 2, 53, 2, 102, 2, 144, 2, 177, 2, 213, 2, 1, 3,
+    51, 3, 109, 3, 172, 3, 229, 3, 30, 4, 87, 4, 148, 4, 206, 4, 5, 5, 63, 5, 123, 5, 180, 5, 238, 5, 33, 6, 87, 6, 147, 6,
+    206, 6, 11, 7, 74, 7, 136, 7, 194, 7, 251, 7, 56, 8, 115, 8, 169, 8, 227, 8, 33, 9, 91, 9, 154, 9, 215, 9, 16, 10, 80, 10,
+    142, 10, 203, 10, 11, 11, 71, 11, 132, 11, 192, 11, 0, 12, 58, 12, 117, 12, 175, 12, 237, 12, 39, 13, 102, 13, 162, 13, 221, 13, 28, 14,
+    66, 0, 48, 64, 54, 6, 54, 48, 8, 0, 6, 3, 6, 64, 1, 64, 9, 66, 3, 27, 64, 1, 69, 3, 64, 51, 3, 1, 3, 65, 51, 3,
+    67, 51, 3, 51, 49, 66, 1, 51, 54, 48, 6, 64, 0, 66, 48, 65, 0, 48, 65, 0, 48, 54, 6, 11, 6, 3, 1, 9, 64, 1, 9, 1,
+    9, 64, 1, 3, 51, 27, 64, 3, 1, 64, 3, 1, 7, 3, 49, 7, 1, 3, 1, 65, 3, 7, 3, 64, 51, 49, 65, 3, 64, 51, 3, 64,
+    1, 49, 51, 6, 3, 6, 64, 0, 65, 48, 68, 0, 6, 64, 0, 2, 14, 3, 6, 70, 1, 3, 64, 1, 51, 57, 3, 7, 64, 1, 7, 64,
+    1, 3, 68, 1, 3, 1, 64, 7, 51, 3, 1, 66, 3, 1, 3, 66, 1, 64, 3, 64, 6, 0, 48, 0, 67, 0, 67, 6, 3, 67, 1, 64,
+    3, 1, 9, 3, 1, 65, 3, 48, 27, 76, 1, 3, 1, 3, 7, 66, 3, 64, 1, 66, 3, 64, 1, 3, 0, 3, 0, 6, 64, 0, 70, 0,
+    64, 3, 6, 65, 1, 64, 9, 64, 3, 11, 9, 1, 65, 3, 0, 3, 48, 25, 64, 3, 1, 3, 72, 1, 74, 3, 1, 3, 64, 1, 3, 64,
+    6, 65, 0, 64, 0, 6, 0, 68, 6, 3, 6, 64, 1, 9, 25, 1, 3, 11, 25, 3, 64, 1, 66, 3, 51, 59, 66, 3, 1, 3, 70, 1,
+    64, 7, 64, 3, 66, 1, 67, 3, 64, 1, 6, 3, 64, 0, 6, 0, 65, 0, 67, 6, 65, 3, 65, 1, 64, 9, 3, 1, 3, 9, 65, 1,
+    0, 3, 1, 64, 3, 48, 27, 0, 64, 3, 7, 66, 3, 66, 1, 72, 3, 1, 3, 1, 3, 66, 1, 64, 6, 64, 0, 68, 0, 66, 6, 3,
+    6, 65, 1, 0, 67, 1, 3, 0, 3, 0, 66, 3, 0, 64, 3, 7, 65, 3, 7, 64, 3, 64, 1, 74, 3, 1, 3, 67, 1, 0, 3, 6,
+    0, 70, 0, 6, 3, 6, 0, 6, 1, 66, 0, 1, 0, 66, 1, 64, 3, 1, 68, 3, 1, 65, 3, 67, 1, 72, 3, 65, 1, 65, 3, 66,
+    1, 3, 6, 70, 0, 64, 6, 65, 1, 65, 0, 24, 25, 0, 8, 30, 25, 65, 1, 0, 1, 0, 7, 65, 3, 0, 3, 0, 3, 1, 3, 64,
+    6, 0, 6, 3, 1, 65, 3, 1, 65, 3, 64, 1, 66, 3, 1, 3, 64, 1, 6, 64, 0, 73, 0, 1, 49, 48, 65, 0, 25, 1, 64, 0,
+    49, 25, 65, 1, 0, 65, 1, 3, 64, 1, 0, 64, 1, 3, 6, 64, 0, 6, 0, 6, 64, 1, 66, 3, 1, 64, 3, 1, 64, 3, 1, 64,
+    3, 65, 1, 64, 6, 0, 73, 0, 1, 6, 65, 0, 1, 67, 0, 1, 49, 24, 70, 1, 3, 1, 3, 64, 6, 65, 0, 6, 0, 3, 1, 3,
+    1, 65, 3, 64, 1, 3, 1, 65, 3, 1, 3, 64, 1, 3, 6, 0, 78, 0, 1, 68, 0, 71, 1, 3, 0, 3, 64, 0, 6, 65, 0, 64,
+    6, 0, 3, 1, 3, 66, 1, 3, 6, 3, 1, 65, 3, 66, 1, 3, 0, 70, 0, 16, 76, 0, 66, 1, 17, 3, 1, 64, 3, 0, 3, 64,
+    0, 6, 0, 6, 65, 0, 64, 6, 0, 64, 6, 64, 1, 0, 3, 66, 6, 69, 1, 3, 0, 66, 0, 16, 24, 0, 16, 64, 0, 1, 70, 0,
+    65, 1, 69, 0, 19, 64, 0, 3, 0, 6, 65, 0, 6, 0, 64, 6, 0, 6, 0, 65, 6, 64, 0, 67, 6, 1, 65, 6, 64, 1, 6, 64,
+    1, 64, 0, 16, 0, 22, 6, 30, 0, 64, 6, 1, 65, 0, 1, 64, 0, 64, 1, 66, 0, 3, 65, 0, 24, 16, 0, 24, 0, 16, 30, 6,
+    65, 0, 64, 6, 22, 0, 67, 6, 0, 64, 6, 66, 0, 65, 6, 65, 0, 66, 6, 66, 52, 6, 64, 0, 32, 9, 64, 6, 14, 0, 13, 9,
+    11, 3, 27, 3, 65, 5, 13, 61, 51, 64, 55, 64, 53, 65, 51, 35, 7, 15, 39, 51, 55, 7, 64, 3, 53, 64, 5, 3, 64, 5, 37, 5,
+    11, 66, 51, 5, 0, 6, 48, 54, 38, 4, 64, 6, 4, 36, 64, 54, 4, 65, 54, 6, 0, 48, 5, 8, 5, 11, 3, 11, 64, 3, 7, 3,
+    64, 51, 64, 5, 59, 51, 53, 51, 64, 55, 51, 35, 5, 3, 35, 7, 37, 55, 39, 64, 55, 51, 53, 64, 5, 7, 37, 64, 35, 11, 5, 53,
+    64, 55, 3, 5, 48, 53, 32, 64, 38, 12, 4, 12, 36, 64, 52, 54, 52, 54, 48, 64, 54, 52, 1, 13, 1, 67, 3, 51, 15, 51, 53, 64,
+    51, 7, 27, 55, 65, 51, 35, 3, 51, 37, 64, 3, 64, 35, 7, 35, 53, 64, 51, 35, 7, 37, 35, 65, 37, 53, 51, 53, 66, 51, 37, 53,
+    64, 32, 38, 14, 52, 64, 38, 65, 54, 66, 48, 49, 53, 11, 66, 3, 5, 39, 51, 27, 53, 51, 65, 53, 0, 61, 51, 55, 64, 35, 3, 64,
+    35, 3, 35, 3, 32, 35, 3, 35, 53, 35, 55, 35, 51, 35, 37, 53, 35, 65, 51, 53, 37, 55, 51, 53, 54, 53, 54, 48, 64, 52, 64, 36,
+    54, 52, 66, 54, 64, 53, 49, 51, 15, 64, 3, 27, 37, 53, 7, 27, 55, 65, 53, 48, 37, 0, 59, 37, 39, 3, 39, 35, 64, 3, 35, 0,
+    35, 32, 3, 32, 51, 66, 53, 37, 51, 35, 66, 53, 37, 51, 37, 35, 51, 53, 49, 48, 54, 38, 52, 36, 38, 33, 38, 49, 33, 65, 48, 49,
+    53, 49, 64, 51, 3, 43, 51, 53, 7, 43, 53, 35, 51, 65, 35, 37, 5, 27, 64, 35, 3, 37, 3, 5, 35, 64, 3, 35, 32, 3, 32, 65,
+    51, 39, 55, 64, 35, 39, 51, 37, 64, 35, 64, 37, 55, 35, 48, 37, 54, 38, 32, 38, 6, 36, 38, 65, 32, 33, 48, 37, 53, 55, 35, 51,
+    35, 3, 27, 37, 35, 15, 27, 35, 51, 35, 32, 37, 35, 64, 3, 0, 61, 0, 39, 55, 3, 5, 64, 39, 7, 3, 35, 0, 35, 37, 55, 64,
+    37, 67, 35, 37, 35, 53, 35, 37, 66, 35, 33, 32, 38, 36, 6, 38, 6, 65, 38, 64, 33, 48, 33, 37, 49, 64, 35, 11, 9, 35, 32, 64,
+    11, 35, 37, 32, 37, 32, 64, 37, 5, 37, 0, 3, 5, 35, 5, 35, 3, 35, 39, 7, 35, 32, 5, 7, 65, 35, 68, 37, 53, 35, 53, 67,
+    35, 38, 37, 32, 36, 64, 0, 32, 67, 38, 33, 37, 33, 36, 33, 32, 14, 12, 64, 32, 8, 9, 66, 35, 5, 37, 64, 35, 37, 5, 7, 64,
+    37, 3, 5, 39, 7, 35, 3, 0, 35, 3, 65, 39, 37, 53, 64, 51, 35, 64, 37, 64, 35, 51, 37, 35, 37, 35, 3, 64, 35, 37, 32, 65,
+    0, 32, 0, 65, 32, 1, 33, 65, 32, 38, 12, 8, 40, 43, 9, 4, 40, 47, 65, 3, 0, 35, 32, 3, 5, 37, 35, 0, 3, 32, 7, 3,
+    37, 33, 1, 38, 33, 5, 35, 39, 55, 64, 39, 37, 53, 37, 64, 35, 37, 64, 35, 37, 35, 37, 35, 3, 32, 64, 38, 68, 0, 32, 0, 32,
+    4, 36, 51, 8, 12, 64, 0, 8, 40, 7, 0, 14, 11, 43, 65, 3, 0, 64, 3, 39, 7, 3, 35, 32, 3, 35, 37, 1, 64, 38, 1, 38,
+    1, 35, 3, 66, 37, 35, 64, 37, 7, 5, 37, 35, 39, 37, 64, 35, 19, 16, 0, 22, 66, 4, 68, 0, 52, 0, 1, 54, 4, 0, 48, 49,
+    64, 0, 54, 49, 51, 11, 41, 64, 3, 7, 64, 3, 35, 3, 7, 5, 35, 5, 1, 32, 6, 38, 6, 32, 6, 5, 39, 37, 35, 5, 64, 37,
+    64, 3, 37, 3, 37, 5, 37, 19, 5, 19, 3, 5, 16, 6, 6, 67, 4, 66, 0, 48, 52, 48, 4, 65, 0, 49, 0, 52, 65, 1, 48, 51,
+    0, 68, 3, 5, 6, 5, 64, 6, 1, 38, 64, 6, 64, 0, 6, 5, 35, 5, 66, 3, 37, 0, 37, 3, 37, 21, 5, 19, 3, 7, 3, 5,
+    22, 64, 6, 67, 4, 20, 8, 64, 48, 1, 0, 1, 0, 64, 1, 0, 4, 0, 1, 0, 1, 0, 48, 3, 19, 15, 5, 3, 64, 5, 6, 5,
+    64, 6, 1, 6, 1, 65, 6, 1, 0, 6, 64, 0, 64, 3, 6, 5, 65, 0, 16, 69, 3, 5, 6, 65, 6, 4, 12, 28, 20, 12, 4, 48,
+    0, 1, 0, 1, 0, 64, 1, 64, 0, 3, 0, 3, 64, 1, 6, 64, 54, 64, 22, 13, 22, 6, 5, 6, 0, 65, 6, 1, 6, 64, 0, 6,
+    0, 6, 1, 64, 0, 64, 6, 65, 0, 17, 0, 3, 65, 0, 64, 3, 0, 64, 3, 64, 6, 14, 22, 8, 17, 24, 4, 48, 64, 0, 1, 0,
+    1, 0, 1, 0, 3, 66, 0, 1, 7, 64, 6, 54, 30, 14, 22, 30, 22, 12, 24, 0, 4, 64, 6, 64, 0, 8, 6, 0, 1, 0, 64, 1,
+    4, 64, 0, 66, 6, 65, 0, 64, 6, 4, 0, 1, 64, 0, 65, 58, 10, 15, 64, 9, 17, 0, 15, 23, 7, 9, 3, 25, 5, 37, 47, 55,
+    65, 59, 3, 43, 63, 59, 13, 59, 11, 15, 64, 63, 23, 13, 5, 21, 63, 13, 65, 15, 59, 64, 11, 15, 64, 11, 19, 11, 7, 55, 15, 63,
+    15, 11, 9, 15, 9, 63, 23, 10, 64, 15, 10, 18, 62, 63, 10, 15, 63, 64, 15, 64, 9, 19, 1, 11, 7, 21, 5, 39, 53, 59, 55, 64,
+    63, 64, 11, 47, 63, 59, 15, 61, 64, 15, 17, 35, 13, 17, 35, 19, 59, 21, 64, 61, 9, 59, 65, 11, 19, 64, 23, 7, 11, 59, 11, 59,
+    15, 11, 57, 59, 17, 64, 23, 2, 10, 2, 18, 64, 58, 55, 58, 15, 57, 64, 63, 61, 17, 3, 9, 15, 37, 39, 64, 37, 61, 27, 63, 59,
+    64, 63, 13, 15, 61, 57, 61, 63, 17, 39, 13, 19, 64, 37, 64, 21, 35, 21, 59, 61, 57, 17, 13, 19, 23, 65, 19, 59, 63, 59, 65, 63,
+    61, 19, 59, 64, 17, 23, 6, 58, 64, 23, 65, 63, 67, 57, 59, 5, 15, 13, 64, 37, 35, 21, 64, 61, 59, 63, 65, 59, 12, 43, 63, 59,
+    21, 23, 37, 23, 21, 39, 23, 37, 22, 21, 39, 21, 59, 23, 61, 17, 63, 23, 19, 59, 23, 65, 63, 59, 19, 59, 63, 59, 63, 59, 62, 57,
+    64, 58, 64, 18, 62, 58, 66, 63, 64, 59, 57, 63, 3, 15, 21, 57, 19, 51, 21, 61, 66, 59, 60, 19, 12, 45, 19, 21, 37, 64, 21, 39,
+    37, 21, 38, 21, 22, 37, 22, 61, 66, 59, 19, 63, 23, 65, 59, 51, 19, 63, 19, 23, 61, 59, 56, 57, 63, 23, 58, 18, 23, 16, 23, 56,
+    16, 66, 57, 59, 57, 63, 61, 23, 25, 57, 59, 21, 29, 59, 23, 63, 65, 23, 19, 11, 15, 64, 23, 39, 19, 37, 35, 23, 37, 39, 21, 22,
+    37, 22, 61, 49, 57, 21, 61, 64, 23, 19, 63, 19, 64, 23, 64, 19, 59, 23, 57, 19, 63, 23, 17, 23, 55, 18, 23, 65, 17, 16, 57, 19,
+    59, 57, 23, 61, 23, 21, 57, 19, 17, 25, 61, 21, 63, 23, 20, 19, 23, 64, 39, 12, 43, 36, 21, 61, 33, 35, 64, 21, 37, 39, 21, 38,
+    21, 19, 61, 64, 19, 67, 23, 19, 23, 59, 23, 19, 23, 65, 21, 16, 17, 23, 18, 55, 23, 55, 65, 23, 64, 16, 57, 17, 19, 57, 64, 21,
+    5, 0, 64, 17, 64, 5, 23, 19, 20, 19, 20, 64, 19, 35, 19, 36, 39, 35, 17, 35, 23, 39, 17, 21, 37, 21, 22, 35, 37, 65, 23, 68,
+    19, 59, 23, 59, 68, 23, 19, 17, 18, 64, 54, 22, 67, 23, 17, 19, 17, 18, 16, 22, 7, 26, 64, 20, 2, 24, 66, 23, 51, 19, 64, 23,
+    19, 35, 33, 64, 19, 39, 35, 21, 37, 23, 37, 38, 21, 37, 65, 21, 19, 59, 64, 63, 23, 64, 19, 64, 23, 63, 19, 23, 19, 23, 55, 64,
+    21, 19, 17, 54, 64, 52, 20, 52, 65, 20, 49, 17, 65, 22, 23, 2, 28, 25, 31, 0, 18, 25, 27, 55, 64, 53, 52, 23, 20, 49, 51, 19,
+    23, 52, 39, 20, 37, 39, 19, 16, 33, 64, 17, 35, 23, 21, 61, 21, 64, 19, 59, 19, 64, 23, 19, 64, 23, 19, 23, 19, 23, 55, 17, 64,
+    23, 68, 52, 20, 52, 20, 50, 18, 13, 6, 10, 64, 12, 1, 26, 11, 12, 7, 15, 31, 64, 55, 53, 52, 53, 55, 19, 53, 55, 21, 20, 39,
+    23, 19, 33, 64, 23, 33, 17, 49, 23, 55, 66, 19, 23, 64, 19, 64, 51, 19, 23, 17, 19, 23, 21, 5, 1, 49, 7, 34, 65, 50, 52, 36,
+    52, 36, 54, 38, 10, 62, 33, 46, 58, 60, 10, 8, 64, 60, 15, 8, 64, 15, 27, 64, 55, 51, 55, 53, 21, 53, 64, 51, 23, 51, 49, 17,
+    49, 23, 49, 17, 49, 51, 64, 19, 23, 51, 64, 19, 64, 55, 19, 55, 19, 51, 19, 7, 51, 23, 55, 51, 1, 55, 39, 34, 64, 50, 64, 34,
+    36, 65, 38, 14, 10, 14, 34, 60, 36, 58, 8, 36, 10, 64, 56, 59, 10, 15, 34, 39, 64, 37, 53, 64, 55, 51, 55, 51, 55, 64, 49, 22,
+    49, 55, 64, 49, 55, 51, 23, 51, 66, 55, 19, 49, 19, 55, 64, 19, 51, 23, 55, 51, 53, 51, 6, 64, 39, 67, 34, 2, 6, 64, 14, 59,
+    33, 32, 36, 59, 32, 60, 58, 36, 32, 57, 32, 58, 10, 63, 7, 3, 35, 39, 35, 51, 39, 35, 39, 49, 32, 49, 48, 55, 49, 55, 48, 49,
+    55, 64, 49, 65, 55, 51, 65, 49, 1, 66, 55, 37, 53, 37, 51, 55, 64, 39, 33, 34, 2, 58, 64, 2, 58, 14, 58, 32, 57, 32, 60, 35,
+    32, 60, 36, 37, 38, 37, 32, 56, 57, 9, 15, 1, 23, 3, 7, 39, 35, 39, 33, 39, 49, 39, 32, 39, 64, 33, 39, 33, 55, 32, 33, 49,
+    64, 55, 33, 64, 49, 0, 49, 55, 49, 33, 49, 55, 39, 49, 64, 37, 64, 39, 7, 64, 1, 0, 57, 58, 9, 57, 34, 56, 33, 32, 34, 32,
+    36, 37, 38, 63, 64, 39, 32, 37, 64, 63, 41, 63, 1, 17, 63, 7, 2, 57, 33, 34, 39, 65, 33, 1, 39, 33, 32, 33, 64, 32, 34, 64,
+    33, 39, 49, 55, 65, 49, 33, 49, 39, 34, 49, 32, 33, 49, 65, 3, 59, 24, 64, 27, 25, 18, 26, 32, 56, 51, 63, 40, 60, 52, 36, 12,
+    65, 47, 64, 63, 21, 1, 62, 7, 63, 61, 64, 4, 12, 31, 23, 14, 4, 63, 29, 64, 28, 7, 64, 31, 24, 15, 65, 31, 20, 12, 60, 4,
+    60, 31, 11, 24, 59, 16, 24, 27, 26, 24, 27, 27, 1, 0, 27, 56, 0, 56, 24, 27, 59, 39, 59, 55, 61, 36, 60, 52, 12, 41, 12, 5,
+    4, 55, 31, 60, 4, 7, 60, 7, 61, 60, 11, 55, 29, 11, 48, 15, 1, 15, 64, 7, 59, 6, 64, 31, 24, 31, 64, 28, 20, 30, 7, 56,
+    16, 28, 31, 1, 7, 27, 24, 26, 19, 11, 19, 27, 64, 3, 8, 19, 56, 3, 16, 0, 7, 36, 63, 48, 65, 52, 53, 52, 20, 41, 20, 7,
+    64, 4, 15, 28, 7, 3, 4, 5, 11, 52, 60, 15, 64, 52, 64, 12, 49, 12, 7, 4, 19, 27, 15, 31, 28, 65, 31, 7, 21, 7, 66, 4,
+    31, 7, 27, 25, 24, 17, 3, 64, 24, 65, 0, 3, 19, 3, 1, 4, 7, 60, 66, 52, 55, 31, 4, 44, 7, 5, 7, 23, 6, 30, 63, 4,
+    0, 28, 13, 52, 64, 12, 53, 13, 52, 9, 12, 52, 12, 7, 28, 7, 27, 0, 28, 31, 7, 28, 4, 5, 4, 7, 30, 0, 4, 7, 2, 7,
+    1, 64, 3, 19, 64, 27, 1, 3, 66, 0, 64, 7, 0, 4, 56, 52, 36, 39, 64, 31, 39, 36, 0, 6, 64, 7, 6, 31, 30, 60, 64, 15,
+    52, 31, 28, 64, 52, 12, 49, 12, 9, 52, 9, 20, 66, 7, 31, 20, 24, 23, 64, 7, 15, 31, 4, 31, 29, 4, 23, 2, 3, 16, 26, 19,
+    27, 24, 26, 24, 2, 26, 1, 64, 19, 2, 7, 64, 4, 20, 36, 63, 5, 7, 39, 60, 7, 28, 5, 24, 28, 29, 31, 15, 64, 28, 12, 52,
+    31, 53, 55, 28, 52, 53, 13, 9, 52, 9, 4, 11, 3, 31, 7, 64, 28, 25, 4, 31, 28, 24, 64, 31, 1, 28, 3, 31, 0, 26, 27, 24,
+    0, 27, 24, 65, 27, 26, 3, 31, 7, 5, 28, 5, 28, 37, 39, 64, 31, 44, 36, 28, 5, 28, 30, 31, 28, 52, 48, 14, 63, 54, 15, 7,
+    51, 55, 64, 15, 55, 52, 28, 49, 12, 31, 7, 64, 31, 67, 28, 31, 28, 23, 29, 31, 66, 28, 26, 27, 24, 27, 0, 24, 0, 24, 26, 24,
+    64, 26, 19, 24, 31, 20, 64, 28, 60, 63, 31, 28, 64, 60, 28, 31, 30, 31, 30, 64, 31, 55, 31, 54, 52, 55, 27, 55, 12, 53, 11, 31,
+    55, 12, 25, 64, 55, 64, 28, 29, 68, 31, 7, 28, 7, 65, 28, 64, 29, 24, 31, 64, 27, 64, 0, 24, 26, 66, 24, 28, 31, 28, 27, 26,
+    25, 56, 43, 64, 30, 60, 47, 66, 28, 7, 31, 64, 28, 31, 55, 53, 64, 31, 52, 55, 31, 55, 28, 52, 49, 28, 52, 66, 31, 7, 64, 4,
+    29, 64, 31, 29, 28, 5, 31, 28, 31, 28, 4, 64, 28, 31, 27, 0, 64, 6, 30, 6, 65, 30, 4, 28, 65, 25, 24, 59, 46, 63, 61, 63,
+    35, 59, 56, 64, 4, 5, 6, 29, 30, 3, 7, 31, 28, 6, 52, 30, 55, 52, 31, 24, 52, 31, 26, 55, 28, 31, 7, 31, 24, 31, 7, 31,
+    64, 28, 31, 28, 24, 31, 28, 31, 28, 4, 25, 64, 24, 68, 6, 30, 6, 30, 3, 27, 60, 9, 35, 64, 54, 62, 60, 48, 54, 58, 4, 60,
+    5, 64, 4, 6, 64, 4, 25, 7, 5, 28, 30, 52, 28, 31, 48, 24, 26, 52, 31, 4, 29, 4, 66, 31, 28, 64, 31, 0, 7, 31, 28, 29,
+    31, 64, 28, 52, 51, 3, 50, 51, 65, 3, 6, 54, 6, 54, 0, 48, 59, 49, 24, 25, 51, 54, 60, 63, 64, 54, 56, 63, 60, 4, 61, 64,
+    4, 1, 5, 4, 28, 5, 0, 7, 28, 7, 4, 27, 7, 24, 7, 25, 64, 7, 24, 31, 29, 7, 64, 31, 5, 4, 31, 4, 31, 7, 31, 52,
+    7, 37, 4, 7, 49, 0, 48, 51, 64, 3, 64, 51, 54, 65, 48, 56, 59, 56, 27, 54, 30, 52, 63, 30, 59, 64, 55, 53, 64, 60, 66, 52,
+    65, 4, 7, 0, 7, 0, 7, 2, 25, 7, 0, 64, 3, 0, 7, 28, 7, 4, 5, 64, 4, 31, 3, 31, 4, 31, 39, 7, 37, 4, 1, 4,
+    7, 49, 64, 48, 68, 51, 48, 64, 56, 53, 30, 31, 30, 53, 31, 54, 51, 30, 31, 54, 31, 52, 60, 64, 52, 48, 55, 52, 55, 7, 48, 55,
+    50, 7, 53, 7, 2, 0, 7, 0, 2, 3, 0, 64, 3, 5, 4, 2, 7, 64, 1, 3, 51, 65, 4, 5, 52, 4, 53, 7, 0, 50, 48, 55,
+    64, 51, 35, 65, 51, 56, 52, 31, 54, 31, 54, 29, 31, 54, 30, 28, 25, 28, 31, 64, 55, 63, 56, 55, 32, 55, 48, 50, 55, 48, 51, 48,
+    7, 48, 50, 48, 64, 51, 48, 51, 0, 50, 51, 3, 64, 0, 51, 64, 3, 50, 3, 5, 3, 51, 3, 4, 52, 3, 64, 52, 65, 48, 55, 49,
+    50, 3, 51, 59, 51, 28, 55, 30, 31, 28, 31, 30, 28, 25, 53, 64, 29, 64, 31, 64, 48, 31, 0, 55, 39, 34, 48, 49, 3, 51, 49, 50,
+    55, 65, 51, 50, 49, 50, 51, 64, 50, 65, 51, 48, 7, 0, 7, 64, 3, 49, 7, 48, 51, 1, 50, 51, 3,
+};
+
+// create the panel and link it to the buffer created above
+Panel panel(buffer);
+void setup()
+{
+}
+
+void loop()
+{
+    panel.displayBuffer();
+}
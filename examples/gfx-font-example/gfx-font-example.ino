@@ -0,0 +1,29 @@
+#define PANEL_MAX_SPEED
+#define PANEL_FONT 2 // proportional GFXfonts
+#include "HUB75nano.h"
+// any font in the GFXfont format works, these two come with the Adafruit GFX library
+#include <Fonts/FreeSans9pt7b.h>
+#include <Fonts/Picopixel.h>
+
+Panel panel = {};
+char title[] = "HUB75";
+char small[] = "proportional text";
+char fixed[] = "3x5 font";
+
+void setup()
+{
+    panel.fillBuffer(Colors::BLACK);
+    // y is the top of the line, every glyph moves on by its own width
+    panel.setFont(&FreeSans9pt7b);
+    panel.drawString(2, 0, title, Colors::WHITE);
+    panel.setFont(&Picopixel);
+    panel.drawString(0, 17, small, Colors::YELLOW);
+    // back to the built in font
+    panel.setFont();
+    panel.drawString(0, 26, fixed, Colors::CYAN);
+}
+
+void loop()
+{
+    panel.displayBuffer();
+}
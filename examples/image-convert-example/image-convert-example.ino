@@ -0,0 +1,45 @@
+#define PANEL_MAX_SPEED
+#include "HUB75nano.h"
+
+// a hue sweep fading to black, error diffused into the 1 bit buffer so the 2 levels per channel look like a gradient
+// made with extras/image-convert, built with the same settings as this sketch:
+// g++ -std=gnu++17 -O2 -I../../src image-convert.cpp -o image-convert && ./image-convert --name sweep sweep.png > sweep.h
+const unsigned char sweep[768] PROGMEM = {
+    65, 18, 4, 73, 16, 76, 193, 50, 12, 131, 52, 8, 130, 32, 9, 130, 32, 9, 130, 32, 200, 134, 96, 88, 134, 105, 16, 36, 65, 144, 4, 73,
+    16, 36, 65, 18, 4, 81, 18, 77, 81, 20, 65, 19, 4, 73, 16, 36, 65, 16, 4, 193, 16, 36, 67, 48, 13, 219, 32, 8, 147, 32, 8, 146,
+    32, 72, 130, 36, 8, 130, 37, 152, 150, 65, 24, 132, 73, 16, 4, 65, 16, 4, 65, 16, 36, 81, 16, 69, 91, 164, 69, 144, 4, 65, 16, 4,
+    65, 18, 36, 65, 18, 12, 193, 50, 8, 131, 48, 41, 130, 32, 9, 130, 32, 8, 130, 96, 72, 130, 33, 24, 6, 105, 17, 6, 65, 144, 4, 73,
+    144, 4, 73, 20, 68, 67, 22, 100, 81, 20, 65, 17, 22, 73, 144, 4, 65, 0, 4, 1, 16, 36, 192, 20, 44, 208, 32, 4, 146, 0, 8, 2,
+    32, 9, 128, 36, 0, 130, 5, 152, 146, 65, 136, 4, 9, 16, 4, 64, 16, 0, 65, 0, 36, 1, 16, 69, 82, 0, 77, 128, 4, 1, 16, 4,
+    65, 144, 4, 193, 16, 8, 193, 32, 12, 131, 0, 8, 194, 32, 9, 146, 32, 0, 130, 32, 24, 34, 96, 8, 132, 65, 24, 148, 64, 144, 4, 65,
+    18, 4, 9, 16, 68, 65, 22, 64, 89, 4, 69, 16, 4, 72, 16, 0, 1, 16, 0, 9, 16, 36, 67, 144, 12, 208, 34, 76, 2, 32, 0, 2,
+    32, 8, 2, 36, 0, 146, 33, 24, 182, 96, 128, 4, 65, 16, 0, 1, 16, 0, 65, 144, 0, 1, 20, 76, 1, 148, 72, 1, 20, 65, 16, 4,
+    65, 0, 4, 1, 16, 9, 129, 48, 1, 131, 0, 8, 128, 32, 8, 128, 32, 1, 130, 32, 0, 2, 96, 1, 6, 1, 24, 4, 64, 2, 4, 65,
+    0, 4, 1, 16, 5, 1, 20, 64, 81, 0, 65, 0, 36, 64, 128, 4, 1, 144, 4, 192, 16, 4, 64, 0, 12, 192, 0, 12, 2, 32, 64, 130,
+    0, 8, 128, 0, 8, 132, 32, 16, 2, 97, 0, 4, 96, 16, 0, 9, 16, 36, 64, 0, 68, 72, 16, 37, 80, 36, 68, 80, 0, 65, 0, 4,
+    64, 0, 4, 64, 2, 12, 137, 48, 0, 131, 4, 8, 144, 0, 8, 128, 0, 8, 18, 96, 72, 128, 64, 136, 132, 64, 19, 2, 1, 16, 0, 1,
+    16, 0, 65, 0, 4, 64, 4, 68, 64, 4, 64, 0, 4, 64, 0, 4, 1, 16, 0, 1, 16, 0, 64, 32, 4, 66, 34, 0, 3, 32, 0, 2,
+    32, 0, 2, 32, 0, 6, 32, 16, 2, 33, 0, 4, 64, 0, 4, 64, 0, 4, 64, 2, 4, 64, 0, 4, 82, 0, 37, 80, 32, 1, 16, 0,
+    64, 0, 4, 64, 32, 4, 3, 16, 8, 128, 0, 8, 128, 0, 8, 144, 0, 8, 128, 0, 8, 128, 64, 72, 132, 64, 16, 2, 9, 16, 0, 1,
+    16, 0, 1, 16, 1, 19, 16, 65, 1, 4, 64, 0, 4, 64, 0, 4, 1, 16, 0, 1, 16, 0, 64, 32, 68, 66, 32, 4, 2, 32, 0, 2,
+    32, 0, 2, 32, 0, 2, 32, 0, 2, 33, 16, 0, 1, 16, 0, 9, 16, 0, 1, 16, 0, 1, 16, 32, 17, 16, 1, 17, 0, 1, 16, 0,
+    64, 0, 4, 64, 0, 4, 74, 0, 12, 0, 32, 0, 128, 0, 8, 128, 0, 0, 2, 0, 24, 128, 1, 16, 2, 1, 0, 4, 64, 0, 4, 64,
+    0, 0, 1, 0, 4, 80, 0, 1, 1, 4, 64, 0, 4, 64, 0, 4, 0, 16, 0, 8, 16, 0, 64, 32, 0, 192, 0, 72, 128, 0, 0, 2,
+    0, 8, 0, 32, 1, 2, 0, 8, 0, 64, 8, 0, 33, 0, 0, 1, 0, 4, 0, 16, 0, 1, 0, 4, 80, 0, 68, 2, 16, 64, 0, 0,
+    64, 0, 0, 129, 0, 4, 128, 16, 0, 2, 0, 4, 2, 0, 8, 0, 32, 0, 2, 0, 0, 128, 64, 128, 6, 0, 16, 0, 64, 0, 4, 0,
+    16, 0, 1, 0, 33, 64, 4, 64, 0, 0, 1, 0, 4, 0, 16, 0, 0, 16, 0, 64, 0, 0, 1, 0, 12, 64, 32, 0, 128, 0, 0, 128,
+    0, 0, 128, 0, 8, 0, 32, 16, 128, 64, 8, 0, 1, 0, 0, 64, 0, 0, 0, 16, 0, 1, 0, 4, 64, 4, 4, 16, 0, 64, 0, 0,
+};
+
+Panel panel = {};
+
+void setup()
+{
+    // copies the image into the buffer, drawing on top of it works as usual
+    panel.loadBuffer(sweep);
+}
+
+void loop()
+{
+    panel.displayBuffer();
+}
@@ -0,0 +1,38 @@
+// 4 palette indices per pixel instead of colors, 512 bytes of ram on a 64x32 panel
+// the image is drawn once, the animation only changes the 4 palette entries
+#define PANEL_PALETTE
+#include "HUB75nano.h"
+
+// create an instance of the panel
+Panel panel = {};
+
+void setup()
+{
+    panel.setPalette(0, COLOR_888_to_444(0, 0, 2));
+    panel.setPalette(1, COLOR_888_to_444(15, 4, 0));
+    panel.setPalette(2, COLOR_888_to_444(6, 15, 9));
+    panel.setPalette(3, COLOR_888_to_444(15, 15, 15));
+    panel.fillBuffer(Colors::INDEX_0); // the drawing color is the index
+    panel.drawCircle(16, 16, 12, Colors::INDEX_1, true);
+    panel.drawCircle(16, 16, 6, Colors::INDEX_2, true);
+    panel.drawRect(34, 4, 60, 27, Colors::INDEX_3, false);
+    panel.drawRect(38, 8, 56, 23, Colors::INDEX_2, true);
+    panel.drawLine(0, 31, 63, 0, Colors::INDEX_3);
+}
+
+void loop()
+{
+    // color cycling, indices 1 to 3 swap their colors
+    const Color first = panel.getPalette(1);
+    panel.setPalette(1, panel.getPalette(2));
+    panel.setPalette(2, panel.getPalette(3));
+    panel.setPalette(3, first);
+    // the background fades in and out
+    static uint8_t level = 0;
+    level = (level + 1) & 15;
+    panel.setPalette(0, COLOR_888_to_444(0, 0, level < 8 ? level : 15 - level));
+    for (uint8_t l = 0; l < 10; l++)
+    {
+        panel.displayBuffer(); // makes the buffer visible and the leds all blinky blinky
+    }
+}
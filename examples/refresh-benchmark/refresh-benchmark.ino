@@ -0,0 +1,185 @@
+// pick the configuration to measure here, every run prints one row of the table
+// #define PANEL_BIG
+// #define PANEL_FLASH
+// #define PANEL_HUB75E
+// #define PANEL_MAX_SPEED
+// #define PANEL_ASM_ROWS
+// #define PANEL_STATS // adds OE duty and the frame time spread, makes the frames a bit slower
+#define MAX_FRAMETIME 127
+#define PANEL_X 64
+#define PANEL_Y 32
+#include "HUB75nano.h"
+// this sketch measures how long displayBuffer() takes, it also runs in simavr (the output goes to the uart)
+
+#define FRAMES 200
+
+#ifdef PANEL_FLASH
+// content does not change the timing, the flash buffer always reads every byte
+const uint8_t image[PANEL_BUFFERSIZE] PROGMEM = {};
+Panel panel(image);
+#else
+Panel panel = {};
+#endif
+
+#ifdef ARDUINO_ARCH_AVR
+// set by the linker, end of the initialized data in flash and end of the static ram
+extern char __data_load_end;
+extern char __bss_end;
+extern char __data_start;
+#endif
+
+const char *modeName()
+{
+#ifdef PANEL_HUB75E
+    // there is no hub75e flash output yet
+    return "hub75e 1 bit";
+#else
+#ifdef PANEL_BIG
+    return "2 bit";
+#else
+#ifdef PANEL_FLASH
+    return "flash 4 bit";
+#else
+#ifdef PANEL_ASM_ROWS
+    return "1 bit asm";
+#else
+    return "1 bit";
+#endif
+#endif
+#endif
+#endif
+}
+
+void setup()
+{
+    Serial.begin(115200);
+#ifndef PANEL_FLASH
+    // something on every row so nothing gets optimized away
+    panel.fillBuffer(Colors::WHITE);
+#endif
+
+    // warm up, the first frame also sets the row pins
+    panel.displayBuffer();
+
+    unsigned long start = micros();
+    for (uint16_t i = 0; i < FRAMES; i++)
+    {
+        panel.displayBuffer();
+    }
+    unsigned long elapsed = micros() - start;
+
+    // cycles per frame from the averaged frame time, micros() has 4us (64 cycles) steps on 16MHz avrs
+    uint32_t cycles = (uint32_t)((uint64_t)elapsed * (F_CPU / 1000000UL) / FRAMES);
+    uint32_t refresh_rate = (uint32_t)((uint64_t)FRAMES * 1000000UL / elapsed);
+
+    Serial.println(F("| mode | size | MAX_FRAMETIME | cycles/frame | refresh Hz | buffer bytes | flash bytes | static ram bytes | OE duty % |"));
+    Serial.println(F("| ---- | ---- | ------------- | ------------ | ---------- | ------------ | ----------- | ---------------- | --------- |"));
+    Serial.print(F("| "));
+    Serial.print(modeName());
+    Serial.print(F(" | "));
+    Serial.print(PANEL_X);
+    Serial.print('x');
+    Serial.print(PANEL_Y);
+    Serial.print(F(" | "));
+    Serial.print(MAX_FRAMETIME);
+    Serial.print(F(" | "));
+    Serial.print(cycles);
+    Serial.print(F(" | "));
+    Serial.print(refresh_rate);
+    Serial.print(F(" | "));
+#ifdef PANEL_FLASH
+    Serial.print(PANEL_BUFFERSIZE); // in flash, nothing in ram
+#else
+    Serial.print((uint16_t)sizeof(panel.buffer));
+#endif
+    Serial.print(F(" | "));
+#ifdef ARDUINO_ARCH_AVR
+    Serial.print((size_t)&__data_load_end);
+    Serial.print(F(" | "));
+    Serial.print((size_t)&__bss_end - (size_t)&__data_start);
+#else
+    Serial.print(F("- | -"));
+#endif
+    Serial.print(F(" | "));
+    // only measured with PANEL_STATS, which makes the frames slower, extras/refresh-matrix takes it from a second build
+#ifdef PANEL_STATS
+    Serial.print(panel.stats().oeDuty());
+#else
+    Serial.print('-');
+#endif
+    Serial.println(F(" |"));
+
+#ifdef PANEL_BOARD_RAM
+    Serial.print(F("estimated by boards/budget.h: "));
+    Serial.print(PanelBudget::cycles_per_frame);
+    Serial.print(F(" cycles/frame, "));
+    Serial.print(PanelBudget::refresh_rate);
+    Serial.println(F(" Hz"));
+#endif
+
+#if defined(PANEL_ASM_ROWS) && defined(TCNT1)
+    // one row of the asm shifter counted with timer 1 at the cpu clock, the empty measurement with the row pointer
+    // loaded the same way is the cost of reading the timer, extras/refresh-matrix fails if the rest is not the budget
+    const uint8_t timer_a = TCCR1A, timer_b = TCCR1B;
+    TCCR1A = 0;
+    TCCR1B = _BV(CS10);
+    const LED *row = panel.buffer;
+    noInterrupts();
+    uint16_t before = TCNT1;
+    __asm__ __volatile__("" ::"x"(row));
+    const uint16_t overhead = TCNT1 - before;
+    before = TCNT1;
+    panel._shiftSmallRowAsm(row);
+    const uint16_t row_cycles = TCNT1 - before - overhead;
+    interrupts();
+    TCCR1A = timer_a;
+    TCCR1B = timer_b;
+    Serial.print(F("asm row cycles: "));
+    Serial.print(row_cycles);
+    Serial.print(F(" measured, "));
+    Serial.print(PANEL_ASM_CYCLES_PER_ROW);
+    Serial.println(F(" budget"));
+#endif
+
+#ifndef PANEL_FLASH
+    // the two buffer setters every drawing function ends up in
+    start = micros();
+    for (uint8_t y = 0; y < PANEL_Y; y++)
+    {
+        for (uint8_t x = 0; x < PANEL_X; x++)
+        {
+            panel.setBuffer(x, y, (x ^ y) & 1 ? Colors::WHITE : Colors::BLUE);
+        }
+    }
+    elapsed = micros() - start;
+    Serial.print(F("setBuffer: "));
+    Serial.print((uint32_t)((uint64_t)elapsed * (F_CPU / 1000000UL) / (PANEL_X * PANEL_Y)));
+    Serial.print(F(" cycles/pixel, setSpan over whole rows: "));
+    start = micros();
+    for (uint8_t y = 0; y < PANEL_Y; y++)
+    {
+        panel.setSpan(0, PANEL_X - 1, y, y & 1 ? Colors::WHITE : Colors::BLUE);
+    }
+    elapsed = micros() - start;
+    Serial.print((uint32_t)((uint64_t)elapsed * (F_CPU / 1000000UL) / (PANEL_X * PANEL_Y / 4)));
+    Serial.println(F(" cycles/4 pixels"));
+#endif
+
+#ifdef PANEL_STATS
+    const PanelStats &stats = panel.stats();
+    Serial.print(F("frame min/avg/max us: "));
+    Serial.print(stats.frame_min);
+    Serial.print('/');
+    Serial.print(stats.frameAverage());
+    Serial.print('/');
+    Serial.print(stats.frame_max);
+    Serial.print(F(", OE duty: "));
+    Serial.print(stats.oeDuty());
+    Serial.println('%');
+#endif
+}
+
+void loop()
+{
+    panel.displayBuffer();
+}
@@ -0,0 +1,20 @@
+#define PANEL_MAX_SPEED
+#define PANEL_SERIAL_INPUT // rectangle updates over Serial, taken in between rows
+#include "HUB75nano.h"
+// this sketch shows what a pc sends in the binary rectangle format of src/output/serial_input.h:
+// 0xA5 'R' x y w h, then w * h LED structs row after row (x and w in groups of 4 columns, y and h in rows of each half)
+// the pc keeps at most 48 bytes unacknowledged and may send 16 more for every 0x06 the panel answers
+
+Panel panel = {};
+
+void setup()
+{
+    Serial.begin(1000000);
+    panel.fillBuffer(Colors::BLACK);
+}
+
+void loop()
+{
+    // the bytes that arrived are taken in after every row, up to 8 per row
+    panel.displayBuffer();
+}
@@ -0,0 +1,21 @@
+#define PANEL_MAX_SPEED
+#define PANEL_SERIAL_STREAM // whole frames over Serial into a second buffer
+#include "HUB75nano.h"
+// this sketch shows frames a pc sends in the format of src/output/serial_input.h: 0xA5 'F' and then the whole buffer,
+// packed like setBuffer() would (768 bytes on 64x32), the frame is shown from the next refresh on.
+// 230400 baud carries 23040 bytes a second, that is 29.9 frames of 770 bytes, 250000 baud about 32.
+// rectangle updates (0xA5 'R') still work and change the frame that is shown
+
+Panel panel = {};
+
+void setup()
+{
+    Serial.begin(250000);
+    panel.fillBuffer(Colors::BLACK);
+}
+
+void loop()
+{
+    // the bytes that arrived are copied into the second buffer after every row, up to 8 per row
+    panel.displayBuffer();
+}
@@ -0,0 +1,31 @@
+// 16x5 cells of text with a color each instead of a pixel buffer, about 210 bytes of ram on a 64x32 panel
+#define PANEL_TEXT_MODE
+#include "HUB75nano.h"
+
+// create an instance of the panel
+Panel panel = {};
+
+uint16_t frames = 0;
+
+void setup()
+{
+    panel.clearText(Colors::BLACK);
+    panel.printText(0, 0, "HUB75nano", Colors::WHITE, Colors::BLUE);
+    panel.printText(0, 1, "text mode", Colors::YELLOW, Colors::BLACK);
+    panel.printText(0, 4, "frames:", Colors::GREEN, Colors::BLACK);
+    for (uint8_t col = 0; col < PANEL_TEXT_COLS; col++)
+    {
+        panel.setCell(col, 2, 'a' + col, Colors::BLACK, col & 1 ? Colors::RED : Colors::CYAN);
+    }
+}
+
+void loop()
+{
+    // rewriting a few cells is all it takes, the next frame already shows them
+    char count[6];
+    utoa(frames++, count, 10);
+    panel.printText(8, 4, count, Colors::WHITE, Colors::BLACK);
+    panel.setCellColor(frames % PANEL_TEXT_COLS, 3, Colors::BLACK, Colors::PURPLE);
+    panel.setCellColor((frames + PANEL_TEXT_COLS - 1) % PANEL_TEXT_COLS, 3, Colors::BLACK, Colors::BLACK);
+    panel.displayBuffer(); // renders the rows from the cells while shifting them out
+}
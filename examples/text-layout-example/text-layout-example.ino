@@ -0,0 +1,33 @@
+#define PANEL_MAX_SPEED
+#include "HUB75nano.h"
+
+Panel panel = {};
+const char message[] = "Long messages wrap into the box at the spaces and page through it.";
+char clock_text[] = "12:00";
+uint16_t clock_width;
+uint16_t page = 0;
+uint8_t seconds = 0;
+
+void setup()
+{
+    // the clock always has the same width, so it is measured once and kept
+    clock_width = panel.measureString(clock_text, 2);
+}
+
+void loop()
+{
+    panel.fillBuffer(Colors::BLACK);
+    // centered at the top, clipped to the panel if it is wider
+    panel.drawAlignedString(PANEL_X / 2, 0, clock_text, TEXT_CENTER, Colors::WHITE, Colors::NO_COLOR, 2, clock_width);
+    // the rest of the message in a box below, the box stays blue where the text ends
+    const uint16_t shown = panel.drawText(0, 12, PANEL_X - 1, PANEL_Y - 1, message + page, TEXT_LEFT, Colors::YELLOW, Colors::BLUE, 1);
+    for (uint16_t frame = 0; frame < 200; frame++)
+    {
+        panel.displayBuffer();
+    }
+    // the next page starts after the last line that fit, or at the start again
+    page = message[page + shown] == 0 || shown == 0 ? 0 : page + shown;
+    seconds = (seconds + 1) % 60;
+    clock_text[3] = '0' + seconds / 10;
+    clock_text[4] = '0' + seconds % 10;
+}
@@ -0,0 +1,36 @@
+// the ram buffer is twice as wide as the panel, the text is drawn into it once
+#define PANEL_CANVAS_X 128
+#include "HUB75nano.h"
+
+// create an instance of the panel
+Panel panel = {};
+
+char text[] = "Hello, World";
+
+void setup()
+{
+    panel.fillBuffer(Colors::RED); // background COLOR
+    panel.drawRect(0, 7, PANEL_CANVAS_X - 1, 23, Colors::BLACK, true);
+    panel.drawBigString(4, 8, text, Colors::WHITE, 3);
+}
+
+void loop()
+{
+    // the panel looks at a different part of the buffer, nothing is redrawn
+    for (uint8_t x = 0; x <= PANEL_CANVAS_X - PANEL_X; x++)
+    {
+        panel.setViewport(x);
+        for (uint8_t l = 0; l < 20; l++)
+        {
+            panel.displayBuffer(); // makes the buffer visible and the leds all blinky blinky
+        }
+    }
+    for (uint8_t x = PANEL_CANVAS_X - PANEL_X; x > 0; x--)
+    {
+        panel.setViewport(x);
+        for (uint8_t l = 0; l < 20; l++)
+        {
+            panel.displayBuffer();
+        }
+    }
+}
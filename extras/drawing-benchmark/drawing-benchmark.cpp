@@ -0,0 +1,393 @@
+// throughput of the drawing primitives, built for the pc with the host board
+// g++ -std=gnu++17 -O2 -I<path to library>/src drawing-benchmark.cpp -o drawing-benchmark            (1 bit buffer, LED_short)
+// g++ -std=gnu++17 -O2 -I<path to library>/src -DPANEL_BIG drawing-benchmark.cpp -o drawing-benchmark (2 bit buffer, LED_long)
+// every draw is checked against a naive per pixel rasterizer that does not call the library, the program returns 1 if any draw differs
+#define PANEL_HOST
+#ifndef PANEL_X
+#define PANEL_X 64
+#endif
+#ifndef PANEL_Y
+#define PANEL_Y 32
+#endif
+#include "HUB75nano.h"
+
+#include <chrono>
+
+#define ROUNDS 2000
+
+Panel panel = {};
+
+#ifdef PANEL_BIG
+#define REFERENCE_DEPTH_MASK 3
+#else
+#define REFERENCE_DEPTH_MASK 1
+#endif
+
+// the reference of the last draw, made without the library, one byte per pixel in the bits the packed buffer keeps:
+// every pixel has to have the color must[] has there, pixels where must[] is black can also have the color of may[]
+// the exact shapes write both, circles and triangles leave the pixels their outline passes through to the rasterizer
+uint8_t must[PANEL_Y][PANEL_X];
+uint8_t may[PANEL_Y][PANEL_X];
+
+// stores what the packed buffer should contain, in the same 1 or 2 bits per channel
+uint8_t packColor(uint32_t color)
+{
+    Color c;
+    c.color_444 = color;
+    return (uint8_t)((c.red & REFERENCE_DEPTH_MASK) | ((c.green & REFERENCE_DEPTH_MASK) << 2) | ((c.blue & REFERENCE_DEPTH_MASK) << 4));
+}
+
+// the pixel has to have color, off the panel is ignored
+void referencePixel(int16_t x, int16_t y, Color color)
+{
+    if (x >= 0 && x < PANEL_X && y >= 0 && y < PANEL_Y)
+    {
+        must[y][x] = packColor(color.color_444);
+        may[y][x] = must[y][x];
+    }
+}
+
+// reads one pixel back out of the packed buffer, bits are allocated lsb first in the LED structs
+uint8_t readPixel(uint8_t x, uint8_t y)
+{
+    const uint8_t half = y < PANEL_Y / 2 ? 0 : 3;
+    const uint16_t index = (panel._bufferRow(y % (PANEL_Y / 2)) * PANEL_CANVAS_X + x) / 4;
+    const uint8_t *bytes = (const uint8_t *)&panel.buffer[index];
+    uint8_t value = 0;
+    for (uint8_t channel = 0; channel < 3; channel++)
+    {
+#ifdef PANEL_BIG
+        const uint8_t low = (x & 3) * 12 + half + channel;
+        const uint8_t high = low + 6;
+        value |= ((bytes[low / 8] >> (low % 8)) & 1) << (channel * 2);
+        value |= ((bytes[high / 8] >> (high % 8)) & 1) << (channel * 2 + 1);
+#else
+        const uint8_t bit = (x & 3) * 6 + half + channel;
+        value |= ((bytes[bit / 8] >> (bit % 8)) & 1) << (channel * 2);
+#endif
+    }
+    return value;
+}
+
+uint32_t compareWithReference()
+{
+    uint32_t mismatches = 0;
+    for (uint8_t y = 0; y < PANEL_Y; y++)
+        for (uint8_t x = 0; x < PANEL_X; x++)
+        {
+            const uint8_t value = readPixel(x, y);
+            if (value != must[y][x] && !(must[y][x] == 0 && value == may[y][x]))
+                mismatches++;
+        }
+    return mismatches;
+}
+
+void clearAll()
+{
+    memset(panel.buffer, 0, sizeof(panel.buffer));
+    memset(must, 0, sizeof(must));
+    memset(may, 0, sizeof(may));
+}
+
+// 1 if the last draw differs from its reference, every draw starts on a black panel
+uint32_t checkDraw()
+{
+    const uint32_t mismatches = compareWithReference();
+    clearAll();
+    return mismatches ? 1 : 0;
+}
+
+// the reference rasterizers, pixel by pixel and without any library code except reading the font
+
+void naiveRect(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, Color color)
+{
+    for (uint8_t y = y1; y <= y2; y++)
+        for (uint8_t x = x1; x <= x2; x++)
+            referencePixel(x, y, color);
+}
+
+// what drawRectHollow drew before setSpan: columns x1 and x2 over y1 to y2, rows y1 and y2 strictly between the columns
+// the corners can come in any order, the columns are drawn anyway and the rows only when x2 > x1 + 1
+void naiveRectHollow(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, Color color)
+{
+    for (uint16_t y = y1; y <= y2; y++)
+    {
+        referencePixel(x1, y, color);
+        referencePixel(x2, y, color);
+    }
+    for (uint16_t x = x1 + 1; x < x2; x++)
+    {
+        referencePixel(x, y1, color);
+        referencePixel(x, y2, color);
+    }
+}
+
+// bresenham from x1, y1 over the first half of the steps, the second half is the first one mirrored through the middle
+// so the line is the same whichever end it starts at, drawLine steps in from both ends at once
+void naiveLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, Color color)
+{
+    const int16_t dx = abs(x2 - x1), sx = x1 < x2 ? 1 : -1, dy = -abs(y2 - y1), sy = y1 < y2 ? 1 : -1;
+    const int16_t steps = max(dx, (int16_t)-dy);
+    int16_t err = dx + dy, x = x1, y = y1;
+    for (int16_t step = 0; 2 * step <= steps; step++)
+    {
+        referencePixel(x, y, color);
+        referencePixel(x1 + x2 - x, y1 + y2 - y, color);
+        const int16_t e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y += sy;
+        }
+    }
+}
+
+// pixels with their center in the circle have to be set, the ones whose square comes within half a pixel of it may be
+// (the circles of fillCircle are a bit squarer than the ideal one)
+void naiveCircle(int16_t cx, int16_t cy, uint8_t radius, Color color)
+{
+    for (int16_t y = 0; y < PANEL_Y; y++)
+        for (int16_t x = 0; x < PANEL_X; x++)
+        {
+            const double dx = x - cx, dy = y - cy;
+            const double near_x = max(fabs(dx) - 0.5, 0.0), near_y = max(fabs(dy) - 0.5, 0.0);
+            if (dx * dx + dy * dy <= (radius - 0.5) * (radius - 0.5) || (dx == 0 && dy == 0))
+                referencePixel(x, y, color);
+            else if (near_x * near_x + near_y * near_y <= (radius + 0.5) * (radius + 0.5))
+                may[y][x] = packColor(color.color_444);
+        }
+}
+
+// twice the signed area of a, b, p, 0 when p is on the line through a and b
+int32_t edgeSide(int16_t ax, int16_t ay, int16_t bx, int16_t by, int16_t px, int16_t py)
+{
+    return (int32_t)(bx - ax) * (py - ay) - (int32_t)(by - ay) * (px - ax);
+}
+
+// pixels with their center in the triangle (edges included) have to be set, the ones whose square touches it may be
+void naiveTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, Color color)
+{
+    const int16_t xs[3] = {x1, x2, x3}, ys[3] = {y1, y2, y3};
+    const int16_t x_min = min(min(x1, x2), x3), x_max = max(max(x1, x2), x3);
+    const int16_t y_min = min(min(y1, y2), y3), y_max = max(max(y1, y2), y3);
+    for (int16_t y = y_min; y <= y_max; y++)
+        for (int16_t x = x_min; x <= x_max; x++)
+        {
+            const int32_t side0 = edgeSide(x1, y1, x2, y2, x, y), side1 = edgeSide(x2, y2, x3, y3, x, y), side2 = edgeSide(x3, y3, x1, y1, x, y);
+            // either winding, a flat triangle is the segment between its outer points and lies within the bounding box
+            if ((side0 >= 0 && side1 >= 0 && side2 >= 0) || (side0 <= 0 && side1 <= 0 && side2 <= 0))
+            {
+                referencePixel(x, y, color);
+                continue;
+            }
+            // separating axes of the square (in doubled coordinates, so the half pixel is whole) and the triangle
+            bool apart = false;
+            for (uint8_t edge = 0; edge < 3 && !apart; edge++)
+            {
+                const int32_t nx = -(ys[(edge + 1) % 3] - ys[edge]), ny = xs[(edge + 1) % 3] - xs[edge];
+                int32_t low = INT32_MAX, high = INT32_MIN;
+                for (uint8_t corner = 0; corner < 3; corner++)
+                {
+                    low = min(low, 2 * (nx * xs[corner] + ny * ys[corner]));
+                    high = max(high, 2 * (nx * xs[corner] + ny * ys[corner]));
+                }
+                const int32_t center = 2 * (nx * x + ny * y), reach = abs(nx) + abs(ny);
+                apart = center + reach < low || center - reach > high;
+            }
+            if (!apart)
+                may[y][x] = packColor(color.color_444);
+        }
+}
+
+// every pixel of the glyph cell, getFontLine has column j in bit PANEL_FONT_X - j, size times larger
+void naiveChar(int16_t x, int16_t y, char letter, Color color, Color bg_color, uint8_t size)
+{
+    for (uint8_t line = 0; line < PANEL_FONT_Y; line++)
+        for (uint8_t column = 0; column < PANEL_FONT_X; column++)
+        {
+            const bool set = getFontLine(letter, line) & (1 << (PANEL_FONT_X - column));
+            if (!set && bg_color.invalid_bits != 0)
+                continue;
+            for (uint8_t i = 0; i < size; i++)
+                for (uint8_t j = 0; j < size; j++)
+                    referencePixel(x + column * size + j, y + line * size + i, set ? color : bg_color);
+        }
+}
+
+void naiveString(int16_t x, int16_t y, const char *str, Color color, Color bg_color)
+{
+    for (; *str != 0; str++, x += PANEL_FONT_X)
+        naiveChar(x, y, *str, color, bg_color, 1);
+}
+
+// xorshift, so every run draws the same workload
+uint32_t random_state = 2463534242;
+uint8_t randomByte(uint8_t limit)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return (uint8_t)(random_state % limit);
+}
+
+Color randomColor()
+{
+    // never black, so the shapes differ from the cleared buffer
+    const uint8_t value = randomByte(7) + 1;
+    return {(uint8_t)((value & 1) ? 15 : 0), (uint8_t)((value & 2) ? 15 : 0), (uint8_t)((value & 4) ? 15 : 0), 0};
+}
+
+enum Primitive
+{
+    LINE,
+    HORIZONTAL_LINE,
+    FILL_RECT,
+    DRAW_RECT,
+    FILL_CIRCLE,
+    FILL_TRIANGLE,
+    DRAW_STRING,
+    DRAW_STRING_BACKGROUND,
+    DRAW_BIG_CHAR,
+    FILL_ROWS,
+    PRIMITIVE_COUNT
+};
+
+const char *primitive_names[PRIMITIVE_COUNT] = {"drawLine", "drawLine (horizontal)", "fillRect", "drawRect (hollow, any corner order)", "fillCircle", "fillTriangle", "drawString", "drawString (background)", "drawBigChar", "fillRows"};
+
+// draws one random instance, with check set its reference is drawn too
+void drawPrimitive(uint8_t primitive, bool check)
+{
+    const Color color = randomColor();
+    switch (primitive)
+    {
+    case LINE:
+    {
+        uint8_t x1 = randomByte(PANEL_X), y1 = randomByte(PANEL_Y), x2 = randomByte(PANEL_X), y2 = randomByte(PANEL_Y);
+        panel.drawLine(x1, y1, x2, y2, color);
+        if (check)
+            naiveLine(x1, y1, x2, y2, color);
+        break;
+    }
+    case HORIZONTAL_LINE:
+    {
+        uint8_t x1 = randomByte(PANEL_X), x2 = randomByte(PANEL_X), y = randomByte(PANEL_Y);
+        panel.drawLine(x1, y, x2, y, color);
+        if (check)
+            naiveRect(min(x1, x2), y, max(x1, x2), y, color);
+        break;
+    }
+    case FILL_RECT:
+    {
+        uint8_t x1 = randomByte(PANEL_X), x2 = randomByte(PANEL_X), y1 = randomByte(PANEL_Y), y2 = randomByte(PANEL_Y);
+        panel.fillRect(min(x1, x2), min(y1, y2), max(x1, x2), max(y1, y2), color);
+        if (check)
+            naiveRect(min(x1, x2), min(y1, y2), max(x1, x2), max(y1, y2), color);
+        break;
+    }
+    case DRAW_RECT:
+    {
+        // half of them with the corners swapped, some with x2 == 0 so x2 - 1 would wrap
+        uint8_t x1 = randomByte(PANEL_X), x2 = randomByte(4) == 0 ? 0 : randomByte(PANEL_X), y1 = randomByte(PANEL_Y), y2 = randomByte(PANEL_Y);
+        panel.drawRect(x1, min(y1, y2), x2, max(y1, y2), color, false);
+        if (check)
+            naiveRectHollow(x1, min(y1, y2), x2, max(y1, y2), color);
+        break;
+    }
+    case FILL_CIRCLE:
+    {
+        // keep the circle on the panel, x below 0 wraps around to the right edge
+        uint8_t radius = randomByte(PANEL_Y / 2 - 1);
+        uint8_t x = radius + randomByte(PANEL_X - 2 * radius), y = radius + randomByte(PANEL_Y - 2 * radius);
+        panel.fillCircle(x, y, radius, color);
+        if (check)
+            naiveCircle(x, y, radius, color);
+        break;
+    }
+    case FILL_TRIANGLE:
+    {
+        uint8_t x1 = randomByte(PANEL_X), y1 = randomByte(PANEL_Y), x2 = randomByte(PANEL_X), y2 = randomByte(PANEL_Y), x3 = randomByte(PANEL_X), y3 = randomByte(PANEL_Y);
+        panel.fillTriangle(x1, y1, x2, y2, x3, y3, color);
+        if (check)
+            naiveTriangle(x1, y1, x2, y2, x3, y3, color);
+        break;
+    }
+    case DRAW_STRING:
+    {
+        uint8_t x = randomByte(PANEL_X / 2), y = randomByte(PANEL_Y - PANEL_FONT_Y);
+        panel.drawString(x, y, (char *)"HUB75", color);
+        if (check)
+            naiveString(x, y, "HUB75", color, Colors::NO_COLOR);
+        break;
+    }
+    case DRAW_STRING_BACKGROUND:
+    {
+        uint8_t x = randomByte(PANEL_X / 2), y = randomByte(PANEL_Y - PANEL_FONT_Y);
+        const Color bg_color = randomColor();
+        panel.drawString(x, y, (char *)"HUB75", color, bg_color);
+        if (check)
+            naiveString(x, y, "HUB75", color, bg_color);
+        break;
+    }
+    case DRAW_BIG_CHAR:
+    {
+        uint8_t size = randomByte(3) + 2;
+        uint8_t x = randomByte(PANEL_X - PANEL_FONT_X * size), y = randomByte(PANEL_Y - PANEL_FONT_Y * size);
+        const char letter = (char)('A' + randomByte(26));
+        panel.drawBigChar(x, y, letter, color, size);
+        if (check)
+            naiveChar(x, y, letter, color, Colors::NO_COLOR, size);
+        break;
+    }
+    case FILL_ROWS:
+    {
+        uint8_t y1 = randomByte(PANEL_Y), y2 = randomByte(PANEL_Y);
+        panel.fillRows(min(y1, y2), max(y1, y2), color);
+        if (check)
+            naiveRect(0, min(y1, y2), PANEL_X - 1, max(y1, y2), color);
+        break;
+    }
+    }
+}
+
+int main()
+{
+    uint32_t failed = 0;
+#ifdef PANEL_BIG
+    printf("LED_long (2 bit), %dx%d\n\n", PANEL_X, PANEL_Y);
+#else
+    printf("LED_short (1 bit), %dx%d\n\n", PANEL_X, PANEL_Y);
+#endif
+    printf("| primitive | setBuffer calls/draw | span calls/draw | masked calls/draw | pixels/draw | pixels/s | failed draws |\n");
+    printf("| --------- | -------------------- | --------------- | ----------------- | ----------- | -------- | ------------ |\n");
+
+    for (uint8_t primitive = 0; primitive < PRIMITIVE_COUNT; primitive++)
+    {
+        // correctness, every draw against its reference rasterizer
+        uint32_t mismatches = 0;
+        clearAll();
+        for (uint16_t i = 0; i < ROUNDS / 10; i++)
+        {
+            drawPrimitive(primitive, true);
+            mismatches += checkDraw();
+        }
+
+        // throughput, without the references
+        virtual_panel.resetDrawCounters();
+        const auto start = std::chrono::steady_clock::now();
+        for (uint16_t i = 0; i < ROUNDS; i++)
+            drawPrimitive(primitive, false);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const uint32_t pixels = virtual_panel.pixel_calls + virtual_panel.span_pixels + virtual_panel.masked_pixels;
+
+        printf("| %s | %.1f | %.1f | %.1f | %.1f | %.0f | %u |\n", primitive_names[primitive],
+               (double)virtual_panel.pixel_calls / ROUNDS, (double)virtual_panel.span_calls / ROUNDS, (double)virtual_panel.masked_calls / ROUNDS,
+               (double)pixels / ROUNDS, seconds > 0 ? pixels / seconds : 0.0, (unsigned)mismatches);
+        failed += mismatches;
+    }
+    return failed ? 1 : 0;
+}
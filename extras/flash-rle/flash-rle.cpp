@@ -0,0 +1,132 @@
+// converts PANEL_FLASH images into PANEL_FLASH_RLE ones, for the pc
+// g++ -std=gnu++17 -O2 flash-rle.cpp -o flash-rle
+// ./flash-rle [width height [duration]] < flash-example.ino > image.h
+// reads the numbers between every = { and the following } (the arrays BMP2HUB75 writes, the rest of a sketch is skipped)
+// one image is printed as a PROGMEM array, more than one as an animation: the encoded frames, which share every row
+// they have in common, and a frame table for playAnimation() that shows each of them for duration milliseconds.
+// the sizes go to stderr, width and height default to 64 and 32, duration to 100
+#include "flash_rle_encode.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+
+#define MAX_FRAMES 64
+
+// reads the next array into image, returns the number of values in it or -1 after the last one
+long readArray(uint8_t *image, size_t size)
+{
+    // only braces after an = open an array, function bodies are skipped
+    int c, last = 0;
+    while ((c = getchar()) != EOF && !(c == '{' && last == '='))
+    {
+        if (!isspace(c))
+        {
+            last = c;
+        }
+    }
+    if (c == EOF)
+    {
+        return -1;
+    }
+    long count = 0;
+    char number[16];
+    size_t digits = 0;
+    while ((c = getchar()) != EOF)
+    {
+        if (isalnum(c) && digits < sizeof(number) - 1)
+        {
+            number[digits++] = (char)c;
+            continue;
+        }
+        if (digits > 0)
+        {
+            number[digits] = 0;
+            if ((size_t)count < size)
+            {
+                image[count] = (uint8_t)strtol(number, NULL, 0);
+            }
+            count++;
+            digits = 0;
+        }
+        if (c == '}')
+        {
+            break;
+        }
+    }
+    return count;
+}
+
+void printBytes(const uint8_t *bytes, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        printf("%s%u,%s", i % 32 == 0 ? "    " : "", bytes[i], i % 32 == 31 || i == length - 1 ? "\n" : " ");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int width = argc > 2 ? atoi(argv[1]) : 64;
+    const int height = argc > 2 ? atoi(argv[2]) : 32;
+    const int duration = argc > 3 ? atoi(argv[3]) : 100;
+    if (width < 8 || width > 128 || height < 8 || height > 64 || duration < 0 || duration > 65535)
+    {
+        fprintf(stderr, "usage: %s [width height [duration]] < image.ino\n", argv[0]);
+        return 1;
+    }
+    const size_t size = (size_t)width * height * 2;
+    uint8_t *images[MAX_FRAMES];
+    uint8_t count = 0;
+    while (count < MAX_FRAMES)
+    {
+        images[count] = (uint8_t *)calloc(size, 1);
+        const long values = readArray(images[count], size);
+        if (values < 0)
+        {
+            free(images[count]);
+            break;
+        }
+        if ((size_t)values != size)
+        {
+            fprintf(stderr, "array %u has %ld values, a %dx%d image has %zu\n", count, values, width, height, size);
+            return 1;
+        }
+        count++;
+    }
+    if (count == 0)
+    {
+        fprintf(stderr, "no image in the input\n");
+        return 1;
+    }
+
+    uint8_t *encoded = (uint8_t *)malloc(count * FLASH_RLE_MAX_SIZE(width, height));
+    const size_t length = flashRleEncodeAnimation(images, count, width, height, encoded);
+    if (count == 1)
+    {
+        printf("// run length encoded for PANEL_FLASH_RLE, %zu bytes instead of %zu\n", length, size);
+        printf("const unsigned char buffer[%zu] PROGMEM = {\n", length);
+        printBytes(encoded, length);
+        printf("};\n");
+    }
+    else
+    {
+        printf("// %u frames run length encoded for PANEL_FLASH_RLE, %zu bytes instead of %zu\n", count, length, count * size);
+        printf("const unsigned char animation[%zu] PROGMEM = {\n", length);
+        printBytes(encoded, length);
+        printf("};\n");
+        printf("const AnimationFrame frames[%u] PROGMEM = {\n", count);
+        for (uint8_t i = 0; i < count; i++)
+        {
+            printf("    {animation + %zu, %d},\n", i * FLASH_RLE_TABLE_SIZE(height), duration);
+        }
+        printf("};\n");
+    }
+    fprintf(stderr, "%u image%s, %zu bytes -> %zu bytes (%.1f%%)\n", count, count == 1 ? "" : "s", count * size, length, 100.0 * length / (count * size));
+    for (uint8_t i = 0; i < count; i++)
+    {
+        free(images[i]);
+    }
+    free(encoded);
+    return 0;
+}
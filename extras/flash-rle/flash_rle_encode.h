@@ -0,0 +1,96 @@
+// run length encoder for PANEL_FLASH_RLE images, for the pc, used by flash-rle.cpp and the golden image check
+// the input is a PANEL_FLASH image: 4 planes of height / 2 rows * width bytes, upper rgb in bits 0-2, lower in bits 3-5
+// the output starts with a little endian 16 bit offset for every row of every plane (plane major, counted from the
+// start of the output), followed by the rows as tokens: below 64 one pixel of that value, from 64 on a run of
+// token - 62 pixels of the value in the next byte. runs end with their row and identical rows are stored once,
+// so the output is never larger than FLASH_RLE_MAX_SIZE
+#ifndef HUB75NANO_FLASH_RLE_ENCODE_H
+#define HUB75NANO_FLASH_RLE_ENCODE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define FLASH_RLE_RUN 64
+#define FLASH_RLE_RUN_BIAS 62
+#define FLASH_RLE_MAX_RUN (255 - FLASH_RLE_RUN_BIAS)
+// the offsets of one image
+#define FLASH_RLE_TABLE_SIZE(height) ((size_t)4 * ((height) / 2) * 2)
+// the offsets plus every row as single pixels
+#define FLASH_RLE_MAX_SIZE(width, height) ((size_t)4 * ((height) / 2) * (2 + (width)))
+
+// the tokens of one row, returns their length, values are cut to the 6 color bits
+inline size_t flashRleEncodeRow(const uint8_t *row, uint8_t width, uint8_t *out)
+{
+    size_t length = 0;
+    uint8_t x = 0;
+    while (x < width)
+    {
+        const uint8_t value = row[x] & 0b111111;
+        uint8_t run = 1;
+        while (x + run < width && run < FLASH_RLE_MAX_RUN && (row[x + run] & 0b111111) == value)
+        {
+            run++;
+        }
+        if (run == 1)
+        {
+            out[length++] = value;
+        }
+        else
+        {
+            // two pixels take two bytes either way, the run clocks faster
+            out[length++] = run + FLASH_RLE_RUN_BIAS;
+            out[length++] = value;
+        }
+        x += run;
+    }
+    return length;
+}
+
+// encodes count images into out (count * FLASH_RLE_MAX_SIZE(width, height) bytes), returns the encoded size
+// all offset tables come first, image i starts at out + i * FLASH_RLE_TABLE_SIZE(height), and the rows of all images
+// follow them. every offset points forward from its own table, so a row an earlier image already has is stored once
+// and a frame that only changes a few rows of its keyframe costs its table and those rows
+inline size_t flashRleEncodeAnimation(const uint8_t *const *images, uint8_t count, uint8_t width, uint8_t height, uint8_t *out)
+{
+    const size_t rows = (size_t)4 * (height / 2);
+    const size_t table = FLASH_RLE_TABLE_SIZE(height);
+    size_t length = count * table;
+    for (size_t image = 0; image < count; image++)
+    {
+        for (size_t row = 0; row < rows; row++)
+        {
+            const uint8_t *pixels = images[image] + row * width;
+            size_t start = length;
+            // a row seen before, in this image or an earlier one, points at the same tokens
+            for (size_t before = 0; before <= image && start == length; before++)
+            {
+                for (size_t other = 0; other < (before == image ? row : rows); other++)
+                {
+                    if (memcmp(images[before] + other * width, pixels, width) == 0)
+                    {
+                        const uint8_t *entry = out + before * table + other * 2;
+                        start = before * table + (entry[0] | (size_t)(entry[1] << 8));
+                        break;
+                    }
+                }
+            }
+            if (start == length)
+            {
+                length += flashRleEncodeRow(pixels, width, out + length);
+            }
+            const size_t offset = start - image * table;
+            out[image * table + row * 2] = (uint8_t)offset;
+            out[image * table + row * 2 + 1] = (uint8_t)(offset >> 8);
+        }
+    }
+    return length;
+}
+
+// encodes image into out (FLASH_RLE_MAX_SIZE(width, height) bytes), returns the encoded size
+inline size_t flashRleEncode(const uint8_t *image, uint8_t width, uint8_t height, uint8_t *out)
+{
+    return flashRleEncodeAnimation(&image, 1, width, height, out);
+}
+
+#endif // HUB75NANO_FLASH_RLE_ENCODE_H
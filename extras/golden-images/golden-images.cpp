@@ -0,0 +1,517 @@
+// renders the draw sequences of the example sketches on the simulated panel and compares them to the ppm files in golden/
+// one build per output mode, run.sh builds and runs all of them:
+// g++ -std=gnu++17 -I<path to library>/src [-DPANEL_BIG | -DPANEL_FLASH | -DPANEL_FLASH_OVERLAY | -DPANEL_FLASH_RLE | -DPANEL_HUB75E | -DPANEL_TEXT_MODE | -DPANEL_PALETTE | -DPANEL_FONT=2] golden-images.cpp -o golden-images
+// -DPANEL_NO_BUFFER fills the panel in immediate mode
+// -DPANEL_CANVAS_X=128 or 256 (with -DPANEL_BIG and -DPANEL_FLIP_HORIZONTAL) renders the viewport scene instead and sweeps every viewport
+// ./golden-images          compares, returns 1 if any frame differs
+// ./golden-images --update writes the current frames as the new golden images
+#define PANEL_HOST
+#include "HUB75nano.h"
+
+#include <string.h>
+
+#ifdef PANEL_NO_BUFFER
+#define MODE_NAME "immediate"
+#else
+#ifdef PANEL_PALETTE
+#define MODE_NAME "palette"
+#else
+#ifdef PANEL_TEXT_MODE
+#define MODE_NAME "text"
+#else
+#ifdef PANEL_HUB75E
+#define MODE_NAME "hub75e"
+#else
+#ifdef PANEL_BIG
+#define MODE_NAME "2bit"
+#else
+#ifdef PANEL_FLASH_OVERLAY
+#define MODE_NAME "flash-overlay"
+#else
+#ifdef PANEL_FLASH_RLE
+#define MODE_NAME "flash-rle"
+#else
+#ifdef PANEL_FLASH
+#define MODE_NAME "flash"
+#else
+#if PANEL_FONT == 2
+#define MODE_NAME "gfx-font"
+#else
+#define MODE_NAME "1bit"
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+
+// the canvas builds only render the viewport, the flipped ones look different
+#if PANEL_CANVAS_X != PANEL_X
+#define CANVAS_NAME_(x) "-canvas" #x
+#define CANVAS_NAME(x) CANVAS_NAME_(x)
+#ifdef PANEL_FLIP_HORIZONTAL
+#define VIEW_NAME CANVAS_NAME(PANEL_CANVAS_X) "-flipped"
+#else
+#define VIEW_NAME CANVAS_NAME(PANEL_CANVAS_X)
+#endif
+#else
+#define VIEW_NAME ""
+#endif
+
+// the darker colors only exist with the 2 bit buffer
+#ifdef PANEL_BIG
+#define SHADE(dark, full) Colors::dark
+#else
+#define SHADE(dark, full) Colors::full
+#endif
+
+#ifdef PANEL_FLASH
+uint8_t image[PANEL_BUFFERSIZE] = {};
+Panel panel(image);
+#ifdef PANEL_FLASH_RLE
+#include "../flash-rle/flash_rle_encode.h"
+// the scenes draw the plain image, the panel shows it encoded
+uint8_t encoded[FLASH_RLE_MAX_SIZE(PANEL_X, PANEL_Y)];
+#endif
+#else
+Panel panel = {};
+#endif
+
+#ifdef PANEL_NO_BUFFER
+// examples/color-example, immediate mode sends one color to the whole panel while it refreshes
+Color immediate_color;
+void immediateScene()
+{
+    immediate_color = COLOR_888_to_444(31, 15, 0);
+}
+#else
+#ifdef PANEL_FLASH
+// flash-example ships a converted photo, a gradient covers the same 4 bit planes without the 4k table
+void gradientScene()
+{
+    // plane major: 4 planes of PANEL_Y/2 rows * PANEL_X bytes, upper rgb in bits 0-2, lower in bits 3-5
+    for (uint8_t plane = 0; plane < 4; plane++)
+        for (uint8_t y = 0; y < PANEL_Y / 2; y++)
+            for (uint8_t x = 0; x < PANEL_X; x++)
+            {
+                const uint8_t red = x >> 2, green = y, blue = 15 - (x >> 2);
+                const uint8_t upper = ((red >> plane) & 1) | (((green >> plane) & 1) << 1) | (((blue >> plane) & 1) << 2);
+                const uint8_t lower = ((blue >> plane) & 1) | (((red >> plane) & 1) << 1) | ((((15 - green) >> plane) & 1) << 2);
+                image[plane * PANEL_X * (PANEL_Y / 2) + y * PANEL_X + x] = upper | (uint8_t)(lower << 3);
+            }
+#ifdef PANEL_FLASH_RLE
+    flashRleEncode(image, PANEL_X, PANEL_Y, encoded);
+    panel.buffer = encoded;
+#endif
+}
+
+#ifdef PANEL_FLASH_RLE
+// a delta frame after the gradient: a white bar over rows 4 to 7 of both halves, the other rows point at the keyframe
+uint8_t bar_image[PANEL_BUFFERSIZE] = {};
+uint8_t animation_data[2 * FLASH_RLE_MAX_SIZE(PANEL_X, PANEL_Y)];
+AnimationFrame animation_frames[2];
+void animationScene()
+{
+    // an empty table must not read a first frame, nullptr crashes the host if it does
+    panel.playAnimation(nullptr, 0);
+    gradientScene();
+    memcpy(bar_image, image, sizeof(image));
+    for (uint8_t plane = 0; plane < 4; plane++)
+        memset(&bar_image[plane * PANEL_X * (PANEL_Y / 2) + 4 * PANEL_X], 0b111111, 4 * PANEL_X);
+    const uint8_t *images[] = {image, bar_image};
+    flashRleEncodeAnimation(images, 2, PANEL_X, PANEL_Y, animation_data);
+    // no duration, the delta frame follows after the first refresh and stays
+    animation_frames[0] = {animation_data, 0};
+    animation_frames[1] = {animation_data + FLASH_RLE_TABLE_SIZE(PANEL_Y), 0};
+    panel.playAnimation(animation_frames, 2, false);
+}
+#endif
+
+#ifdef PANEL_FLASH_OVERLAY
+// a clock and a status bar drawn into the overlay over the gradient
+void overlayScene()
+{
+    gradientScene();
+    panel.clearOverlay();
+    panel.setOverlayColor(COLOR_888_to_444(15, 15, 15));
+    char time[] = "12:34";
+    panel.drawBigString(12, 8, time, Colors::WHITE, 2);
+    panel.drawRect(0, 27, 63, 31, Colors::WHITE, true);
+    panel.drawRect(2, 29, 40, 29, Colors::BLACK, true);
+}
+#endif
+#else
+#ifdef PANEL_PALETTE
+// examples/palette-example, the shapes drawn with indices and the palette from its setup
+void paletteScene()
+{
+    panel.setPalette(0, COLOR_888_to_444(0, 0, 2));
+    panel.setPalette(1, COLOR_888_to_444(15, 4, 0));
+    panel.setPalette(2, COLOR_888_to_444(6, 15, 9));
+    panel.setPalette(3, COLOR_888_to_444(15, 15, 15));
+    panel.fillBuffer(Colors::INDEX_0);
+    panel.drawCircle(16, 16, 12, Colors::INDEX_1, true);
+    panel.drawCircle(16, 16, 6, Colors::INDEX_2, true);
+    panel.drawRect(34, 4, 60, 27, Colors::INDEX_3, false);
+    panel.drawRect(38, 8, 56, 23, Colors::INDEX_2, true);
+    panel.drawLine(0, 31, 63, 0, Colors::INDEX_3);
+}
+
+// the palette rotated by one, no pixel written
+void paletteCycleScene()
+{
+    paletteScene();
+    const Color first = panel.getPalette(1);
+    panel.setPalette(1, panel.getPalette(2));
+    panel.setPalette(2, panel.getPalette(3));
+    panel.setPalette(3, first);
+}
+#else
+#ifdef PANEL_TEXT_MODE
+// examples/text-example after its first frame, plus the tiles below the last whole cell row
+void textScene()
+{
+    panel.clearText(Colors::BLACK);
+    panel.printText(0, 0, "HUB75nano", Colors::WHITE, Colors::BLUE);
+    panel.printText(0, 1, "text mode", Colors::YELLOW, Colors::BLACK);
+    panel.printText(0, 4, "frames:", Colors::GREEN, Colors::BLACK);
+    for (uint8_t col = 0; col < PANEL_TEXT_COLS; col++)
+    {
+        panel.setCell(col, 2, 'a' + col, Colors::BLACK, col & 1 ? Colors::RED : Colors::CYAN);
+    }
+    panel.printText(8, 4, "0", Colors::WHITE, Colors::BLACK);
+    panel.setCellColor(1, 3, Colors::BLACK, Colors::PURPLE);
+    panel.printText(12, 3, "gjpq", Colors::CYAN, Colors::BLACK);
+}
+#else
+// examples/drawing-example
+void drawingScene()
+{
+    panel.fillBuffer(Colors::BLACK);
+    panel.drawRect(0, 0, 5, 10, Colors::YELLOW, true);
+    panel.drawRect(25, 16, 29, 23, Colors::GREEN, false);
+    panel.drawLine(6, 0, 63, 31, Colors::WHITE);
+    panel.drawCircle(50, 10, 5, Colors::BLUE, false);
+    panel.drawCircle(11, 25, 5, SHADE(DARKBLUE, BLUE), true);
+    panel.drawEllipse(30, 6, 6, 3, Colors::GREEN, false);
+    panel.drawEllipse(60, 19, 3, 8, SHADE(DARKPURPLE, PURPLE), true);
+}
+
+// examples/big-font-example, one size of each
+void bigFontScene()
+{
+    panel.fillBuffer(Colors::BLACK);
+    panel.drawBigChar(0, 0, 'A', Colors::RED, Colors::NO_COLOR, 1);
+    panel.drawBigChar(4, 0, 'a', Colors::GREEN, Colors::NO_COLOR, 1);
+    panel.drawBigChar(8, 0, 'B', Colors::BLUE, Colors::NO_COLOR, 1);
+    panel.drawBigChar(12, 0, 'b', Colors::WHITE, Colors::NO_COLOR, 1);
+    panel.drawBigChar(0, 6, 'I', SHADE(DARKERBLUE, BLUE), Colors::NO_COLOR, 2);
+    panel.drawBigChar(8, 6, 'i', SHADE(DARKERWHITE, WHITE), Colors::NO_COLOR, 2);
+    panel.drawBigChar(16, 6, 'J', SHADE(DARKERPURPLE, PURPLE), Colors::NO_COLOR, 2);
+    panel.drawBigChar(0, 17, 'M', Colors::WHITE, Colors::NO_COLOR, 3);
+    panel.drawBigChar(16, 17, 'm', Colors::PURPLE, Colors::NO_COLOR, 3);
+    panel.drawBigChar(48, 17, 'n', Colors::CYAN, Colors::RED, 3);
+}
+
+// examples/scrolling-example, the step where the first letter has wrapped around the 6 bit x
+void scrollingScene()
+{
+    const char text[] = "     Hello, World!     ";
+    const uint8_t j = 5, i = 3;
+    panel.fillBuffer(Colors::RED);
+    panel.drawRect(0, 7, 63, 23, Colors::BLACK, true);
+    for (uint8_t letter = 0; letter < 6; letter++)
+    {
+        const uint8_t x = (uint8_t)(letter * 10 - i) & 63;
+        panel.drawBigChar(x, letter == 0 ? 7 + (i == 0) : 8, text[j + letter], Colors::WHITE, 3);
+    }
+}
+
+// examples/bitmap-example
+const uint8_t heart[8] PROGMEM = {0b01100110, 0b11111111, 0b11111111, 0b11111111, 0b01111110, 0b00111100, 0b00011000, 0b00000000};
+const uint8_t smiley[16] PROGMEM = {
+    0b00000101, 0b01010000, 0b00010101, 0b01010100, 0b01011001, 0b01100101, 0b01010101, 0b01010101,
+    0b01100101, 0b01011001, 0b01011010, 0b10100101, 0b00010111, 0b11010100, 0b00000101, 0b01010000};
+const Color smiley_palette[4] = {Colors::NO_COLOR, Colors::YELLOW, Colors::BLACK, Colors::RED};
+
+void bitmapScene()
+{
+    panel.fillBuffer(SHADE(DARKBLUE, BLUE));
+    panel.drawBitmap(2, 2, 8, 8, heart, Colors::RED);
+    panel.drawBitmap(14, 2, 8, 8, heart, Colors::WHITE, Colors::BLACK);
+    panel.drawIndexedBitmap(26, 2, 8, 8, smiley, 2, smiley_palette);
+    panel.drawIndexedBitmap(60, 20, 8, 8, smiley, 2, smiley_palette);
+}
+
+#if PANEL_FONT == 2
+// a proportional GFXfont made from the 3x5 font: empty columns and rows cut off, one column of spacing, descenders below
+// the baseline, every third glyph hangs one column into the one before it (negative xOffset) like an italic font
+uint8_t test_bitmap[96 * 6];
+GFXglyph test_glyphs[95];
+GFXfont test_font = {test_bitmap, test_glyphs, 32, 126, 7};
+
+void buildTestFont()
+{
+    uint16_t bit = 0;
+    memset(test_bitmap, 0, sizeof(test_bitmap));
+    for (uint8_t letter = 32; letter <= 126; letter++)
+    {
+        uint8_t lines[6], used = 0;
+        for (uint8_t row = 0; row < 6; row++)
+        {
+            // columns 0 to 2 in bits 3 to 1
+            lines[row] = getFontLine(letter, row) >> 1;
+            used |= lines[row];
+        }
+        uint8_t left = 0, right = 3, top = 0, bottom = 6;
+        while (left < 3 && !(used & (4 >> left)))
+            left++;
+        while (right > left && !(used & (4 >> (right - 1))))
+            right--;
+        while (top < 6 && lines[top] == 0)
+            top++;
+        while (bottom > top && lines[bottom - 1] == 0)
+            bottom--;
+        const uint8_t width = right - left, height = width ? bottom - top : 0;
+        const int8_t x_offset = width && letter % 3 == 0 ? -1 : 0;
+        test_glyphs[letter - 32] = {(uint16_t)(bit / 8), width, height, (uint8_t)(width ? width + 1 : 3), x_offset, (int8_t)(top - 5)};
+        // every glyph starts at a whole byte, its rows follow each other without padding
+        for (uint8_t row = top; row < bottom && width; row++)
+            for (uint8_t column = left; column < right; column++, bit++)
+                if (lines[row] & (4 >> column))
+                    test_bitmap[bit / 8] |= 0x80 >> (bit % 8);
+        bit = (bit + 7) & ~7;
+    }
+}
+
+void proportionalScene()
+{
+    buildTestFont();
+    panel.fillBuffer(Colors::BLACK);
+    panel.setFont(&test_font);
+    char first[] = "Hello, proportional!";
+    char second[] = "mil 1234";
+    char clipped[] = "clip";
+    char big[] = "Wij";
+    char fixed[] = "3x5";
+    panel.drawString(0, 0, first, Colors::WHITE);
+    panel.drawString(0, 8, second, Colors::YELLOW, Colors::BLUE);
+    panel.drawString(54, 8, clipped, Colors::GREEN, Colors::RED);
+    panel.drawBigString(0, 16, big, Colors::CYAN, 2);
+    panel.drawBigChar(30, 16, 'q', Colors::PURPLE, Colors::BLUE, 2);
+    panel.setFont();
+    panel.drawString(44, 24, fixed, Colors::GREEN);
+}
+#endif
+
+// drawText wrapping into boxes with every alignment, a measured drawAlignedString and a clip that cuts glyphs
+void textLayoutScene()
+{
+    panel.fillBuffer(Colors::BLACK);
+    panel.drawRect(0, 0, 31, 19, SHADE(DARKBLUE, BLUE), false);
+#if PANEL_FONT == 2
+    // the proportional font in the first box
+    buildTestFont();
+    panel.setFont(&test_font);
+#endif
+    panel.drawText(1, 1, 30, 18, "wrap me into a box", TEXT_LEFT, Colors::WHITE);
+#if PANEL_FONT == 2
+    panel.setFont();
+#endif
+    panel.drawText(33, 0, 63, 13, "in the\nmiddle", TEXT_CENTER, Colors::YELLOW, Colors::BLUE, 1);
+    panel.drawText(33, 14, 63, 19, "abcdefghijk", TEXT_RIGHT, Colors::CYAN);
+    const uint16_t width = panel.measureString("12:34", 2);
+    panel.drawAlignedString(63, 21, "12:34", TEXT_RIGHT, Colors::GREEN, Colors::NO_COLOR, 2, width);
+    panel.setTextClip(2, 22, 20, 27);
+    panel.drawBigString(-5, 20, "clip", Colors::RED, 2);
+    panel.clearTextClip();
+}
+
+// the drawing scene moved with scrollUp/scrollDown, the rows cross between the halves and row_origin wraps
+void rowScrollScene()
+{
+    drawingScene();
+    panel.scrollUp(5);
+    panel.scrollDown(13, Colors::RED);
+    panel.scrollUp(20, Colors::GREEN);
+}
+#endif
+#endif
+#endif
+#endif
+
+#if PANEL_CANVAS_X != PANEL_X
+// the drawing scene on the left of the canvas and a line, a circle and text that cross into the right part
+// the viewport starts at the second pixel of an LED struct, so the row tail is shifted out too
+void viewportScene()
+{
+    drawingScene();
+    panel.drawLine(40, 31, PANEL_CANVAS_X - 1, 0, Colors::RED);
+    panel.drawCircle(PANEL_X, 16, 9, Colors::CYAN, false);
+    panel.drawRect(PANEL_X + 20, 20, PANEL_CANVAS_X - 1, 31, SHADE(DARKGREEN, GREEN), true);
+    char text[] = "viewport";
+    panel.drawString(PANEL_X - 8, 2, text, Colors::WHITE);
+    panel.setViewport(37);
+}
+
+// some color for every pixel of the canvas, shifted by offset columns
+Color viewportPattern(int16_t x, uint8_t y)
+{
+    const uint16_t hash = (uint16_t)((x + 256) * 53 + y * 97) ^ (uint16_t)((x + 256) >> 2);
+    return {(uint8_t)(hash & 15), (uint8_t)((hash >> 4) & 15), (uint8_t)((hash >> 8) & 15), 0};
+}
+
+void drawViewportPattern(int16_t offset)
+{
+    for (uint8_t y = 0; y < PANEL_Y; y++)
+        for (uint16_t x = 0; x < PANEL_CANVAS_X; x++)
+            panel.setBuffer(x, y, viewportPattern(x + offset, y));
+}
+
+void render();
+
+// every viewport has to show the same frame as the pattern drawn that many columns further left with the viewport at 0
+// this goes through every view_led and view_shift, the partial tails and (if it is set) the flipped canvas
+uint8_t viewportSweep()
+{
+    static uint8_t expected[PANEL_Y * PANEL_X * 3], actual[PANEL_Y * PANEL_X * 3];
+    uint8_t failed = 0;
+    for (uint8_t view = 0; view <= PANEL_CANVAS_X - PANEL_X; view++)
+    {
+        drawViewportPattern(view);
+        panel.setViewport(0);
+        render();
+        virtual_panel.toRGB(expected);
+        drawViewportPattern(0);
+        panel.setViewport(view);
+        render();
+        virtual_panel.toRGB(actual);
+        if (memcmp(expected, actual, sizeof(actual)) != 0)
+        {
+            printf("differs viewport %d of the %s%s sweep\n", view, MODE_NAME, VIEW_NAME);
+            failed++;
+        }
+    }
+    panel.setViewport(0);
+    if (!failed)
+    {
+        printf("ok      viewport sweep %s%s\n", MODE_NAME, VIEW_NAME);
+    }
+    return failed;
+}
+#endif
+
+typedef struct Scene
+{
+    const char *name;
+    void (*draw)();
+} Scene;
+
+const Scene scenes[] = {
+#if PANEL_CANVAS_X != PANEL_X
+    {"viewport", viewportScene},
+#else
+#ifdef PANEL_NO_BUFFER
+    {"fill", immediateScene},
+#else
+#ifdef PANEL_FLASH
+    {"gradient", gradientScene},
+#ifdef PANEL_FLASH_OVERLAY
+    {"overlay", overlayScene},
+#endif
+#ifdef PANEL_FLASH_RLE
+    {"animation", animationScene},
+#endif
+#else
+#ifdef PANEL_PALETTE
+    {"palette", paletteScene},
+    {"palette-cycle", paletteCycleScene},
+#else
+#ifdef PANEL_TEXT_MODE
+    {"text", textScene},
+#else
+    {"drawing", drawingScene},
+    {"big-font", bigFontScene},
+    {"scrolling", scrollingScene},
+    {"bitmap", bitmapScene},
+    {"row-scroll", rowScrollScene},
+    {"text-layout", textLayoutScene},
+#if PANEL_FONT == 2
+    {"proportional", proportionalScene},
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+};
+
+// the second frame, so the row latched first already shows this image
+void render()
+{
+#ifdef PANEL_NO_BUFFER
+    panel.fillScreenColor(immediate_color);
+    virtual_panel.beginFrame();
+    panel.fillScreenColor(immediate_color);
+#else
+    panel.displayBuffer();
+    virtual_panel.beginFrame();
+    panel.displayBuffer();
+#endif
+}
+
+bool sameFile(const char *a, const char *b)
+{
+    FILE *first = fopen(a, "rb");
+    FILE *second = fopen(b, "rb");
+    bool same = first && second;
+    while (same)
+    {
+        const int c = fgetc(first);
+        same = c == fgetc(second);
+        if (c == EOF)
+            break;
+    }
+    if (first)
+        fclose(first);
+    if (second)
+        fclose(second);
+    return same;
+}
+
+int main(int argc, char **argv)
+{
+    const bool update = argc > 1 && strcmp(argv[1], "--update") == 0;
+    uint8_t failed = 0;
+    for (const Scene &scene : scenes)
+    {
+        char golden[128], actual[128];
+        snprintf(golden, sizeof(golden), "golden/%s%s-%s.ppm", MODE_NAME, VIEW_NAME, scene.name);
+        snprintf(actual, sizeof(actual), "%s%s-%s.ppm", MODE_NAME, VIEW_NAME, scene.name);
+
+        scene.draw();
+        render();
+        virtual_panel.writePPM(update ? golden : actual);
+        if (update)
+        {
+            printf("updated %s\n", golden);
+        }
+        else if (sameFile(golden, actual))
+        {
+            printf("ok      %s\n", golden);
+            remove(actual);
+        }
+        else
+        {
+            printf("differs %s, see %s\n", golden, actual);
+            failed++;
+        }
+    }
+#if PANEL_CANVAS_X != PANEL_X
+    failed += viewportSweep();
+#endif
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,12 @@
+#!/bin/sh
+# builds the golden image check for every output mode and runs it, pass --update to rewrite the images
+cd "$(dirname "$0")" || exit 1
+failed=0
+for mode in "" "-DPANEL_BIG" "-DPANEL_FLASH" "-DPANEL_FLASH_OVERLAY" "-DPANEL_FLASH_RLE" "-DPANEL_HUB75E" "-DPANEL_TEXT_MODE" "-DPANEL_PALETTE" "-DPANEL_FONT=2" "-DPANEL_NO_BUFFER" \
+    "-DPANEL_CANVAS_X=128" "-DPANEL_CANVAS_X=128 -DPANEL_BIG" "-DPANEL_CANVAS_X=128 -DPANEL_FLIP_HORIZONTAL" "-DPANEL_CANVAS_X=128 -DPANEL_BIG -DPANEL_FLIP_HORIZONTAL" \
+    "-DPANEL_CANVAS_X=256" "-DPANEL_CANVAS_X=256 -DPANEL_BIG -DPANEL_FLIP_HORIZONTAL"; do
+    ${CXX:-g++} -std=gnu++17 -O1 -I../../src $mode golden-images.cpp -o golden-images || exit 1
+    ./golden-images "$@" || failed=1
+done
+rm -f golden-images
+exit $failed
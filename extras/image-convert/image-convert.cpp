@@ -0,0 +1,351 @@
+// converts ppm and png frames into the buffer layout of the library, for the pc
+// built against the library with the same settings as the sketch, so the output always matches the layout it was built for:
+// g++ -std=gnu++17 -O2 -I<path to library>/src [-DPANEL_X=.. -DPANEL_Y=..] [-DPANEL_BIG | -DPANEL_FLASH | -DPANEL_FLASH_RLE | -DPANEL_HUB75E ...] image-convert.cpp -o image-convert
+// ./image-convert [options] frame.png [frame.ppm ...] > image.h
+//   --name name       name of the array, image by default
+//   --gamma g         the input is taken as g encoded (2.2 by default, 1 keeps the values as they are)
+//   --dither kind     floyd (default), atkinson or none, how the error of every pixel is spread to the ones not done yet
+//   --duration ms     how long each frame of an animation shows, 100 by default
+//   --preview file    the first frame as the simulated panel shows it, a ppm in linear light
+// every frame has to be the size of the buffer (PANEL_CANVAS_X * PANEL_Y, PANEL_X * PANEL_Y with the flash buffers).
+// the colors are cut to the levels the layout has (2, 4 or 16 per channel) in linear light, the panel dims by on time.
+// the ram layouts are written with setBuffer() of the library itself, flips and HUB75E rows included, load them with
+// loadBuffer(). the flash layouts are the 4 bit planes flash-example uses, or with PANEL_FLASH_RLE the encoding of
+// extras/flash-rle, more than one frame becomes an AnimationFrame table for playAnimation()
+#define PANEL_HOST
+#include "HUB75nano.h"
+#include "image_read.h"
+
+#if defined(PANEL_TEXT_MODE) || defined(PANEL_PALETTE) || defined(PANEL_NO_BUFFER)
+#error "the converter writes the 1 bit, 2 bit and flash layouts, the text mode, palette and immediate mode have no image buffer"
+#endif
+
+#ifdef PANEL_FLASH_RLE
+#include "../flash-rle/flash_rle_encode.h"
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef PANEL_FLASH
+// the flash buffers hold the image as it is shown, 2 bytes per pixel column pair and plane
+#define IMAGE_X PANEL_X
+#define FRAME_BYTES PANEL_BUFFERSIZE
+#else
+#define IMAGE_X PANEL_CANVAS_X
+#define FRAME_BYTES sizeof(panel.buffer)
+#endif
+// levels of every channel, a Color holds MAX_COLORDEPTH bits of them
+#define LEVELS (1 << MAX_COLORDEPTH)
+#define MAX_FRAMES 64
+
+#ifdef PANEL_FLASH_RLE
+#define MODE_NAME "PANEL_FLASH_RLE"
+#else
+#ifdef PANEL_FLASH
+#define MODE_NAME "PANEL_FLASH"
+#else
+#ifdef PANEL_BIG
+#define MODE_NAME "PANEL_BIG"
+#else
+#define MODE_NAME "1 bit"
+#endif
+#endif
+#endif
+#ifdef PANEL_HUB75E
+#define ROW_ORDER " HUB75E"
+#else
+#define ROW_ORDER ""
+#endif
+
+#ifdef PANEL_FLASH
+uint8_t preview[FRAME_BYTES];
+Panel panel(preview);
+#else
+Panel panel = {};
+#endif
+
+// one step of an error diffusion kernel, the error goes to x + dx, y + dy (dx mirrored on right to left rows)
+typedef struct Diffusion
+{
+    int8_t dx;
+    int8_t dy;
+    uint8_t weight;
+} Diffusion;
+
+const Diffusion floyd[] = {{1, 0, 7}, {-1, 1, 3}, {0, 1, 5}, {1, 1, 1}};
+// spreads only 6/8 of the error, keeps more contrast with few levels
+const Diffusion atkinson[] = {{1, 0, 1}, {2, 0, 1}, {-1, 1, 1}, {0, 1, 1}, {1, 1, 1}, {0, 2, 1}};
+
+typedef struct Options
+{
+    const char *name;
+    float gamma;
+    const Diffusion *kernel;
+    uint8_t kernel_length;
+    uint8_t divisor;
+    const char *dither;
+    int duration;
+    const char *preview;
+} Options;
+
+// the level of every channel, IMAGE_X * PANEL_Y * 3 bytes, error diffusion runs in serpentine order
+void quantize(const Image &image, const Options &options, uint8_t *levels)
+{
+    static float light[IMAGE_X * PANEL_Y * 3];
+    for (size_t i = 0; i < sizeof(light) / sizeof(light[0]); i++)
+    {
+        light[i] = powf(image.rgb[i] / 255.0f, options.gamma) * (LEVELS - 1);
+    }
+    for (int y = 0; y < PANEL_Y; y++)
+    {
+        const bool backwards = y & 1;
+        for (int step = 0; step < IMAGE_X; step++)
+        {
+            const int x = backwards ? IMAGE_X - 1 - step : step;
+            for (uint8_t c = 0; c < 3; c++)
+            {
+                const float value = light[(y * IMAGE_X + x) * 3 + c];
+                const int level = value <= 0 ? 0 : value >= LEVELS - 1 ? LEVELS - 1 : (int)(value + 0.5f);
+                levels[(y * IMAGE_X + x) * 3 + c] = level;
+                const float error = value - level;
+                for (uint8_t k = 0; k < options.kernel_length; k++)
+                {
+                    const int tx = x + (backwards ? -options.kernel[k].dx : options.kernel[k].dx), ty = y + options.kernel[k].dy;
+                    if (tx >= 0 && tx < IMAGE_X && ty < PANEL_Y)
+                    {
+                        light[(ty * IMAGE_X + tx) * 3 + c] += error * options.kernel[k].weight / options.divisor;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// the levels in the layout of the buffer, FRAME_BYTES bytes
+void pack(const uint8_t *levels, uint8_t *out)
+{
+#ifdef PANEL_FLASH
+    // plane major: 4 planes of PANEL_Y/2 rows * PANEL_X bytes, upper rgb in bits 0-2, lower in bits 3-5, plane 0 holds the msb,
+    // the output applies the flips itself
+    for (uint8_t plane = 0; plane < 4; plane++)
+        for (uint8_t y = 0; y < PANEL_Y / 2; y++)
+            for (uint8_t x = 0; x < PANEL_X; x++)
+            {
+                const uint8_t bit = 3 - plane;
+                uint8_t halves[2];
+                for (uint8_t half = 0; half < 2; half++)
+                {
+                    const uint8_t *pixel = &levels[((y + half * (PANEL_Y / 2)) * IMAGE_X + x) * 3];
+                    halves[half] = ((pixel[0] >> bit) & 1) | (((pixel[1] >> bit) & 1) << 1) | (((pixel[2] >> bit) & 1) << 2);
+                }
+                out[plane * PANEL_X * (PANEL_Y / 2) + y * PANEL_X + x] = halves[0] | (uint8_t)(halves[1] << 3);
+            }
+#else
+    // the library packs it, so the converter cannot drift from setBuffer()
+    panel.clearBuffer();
+    for (uint8_t y = 0; y < PANEL_Y; y++)
+        for (uint8_t x = 0; x < IMAGE_X; x++)
+        {
+            const uint8_t *pixel = &levels[(y * IMAGE_X + x) * 3];
+            panel.setBuffer(x, y, COLOR_888_to_444(pixel[0], pixel[1], pixel[2]));
+        }
+    memcpy(out, panel.buffer, FRAME_BYTES);
+#endif
+}
+
+void printBytes(const uint8_t *bytes, size_t length, const char *indent)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        printf("%s%u,%s", i % 32 == 0 ? indent : "", bytes[i], i % 32 == 31 || i == length - 1 ? "\n" : " ");
+    }
+}
+
+// false if there is no memory for the encoder, nothing is printed then
+bool printFrames(uint8_t **frames, uint8_t count, const Options &options)
+{
+#ifdef PANEL_FLASH_RLE
+    uint8_t *encoded = (uint8_t *)calloc(count, FLASH_RLE_MAX_SIZE(PANEL_X, PANEL_Y));
+    if (!encoded)
+    {
+        return false;
+    }
+#endif
+    printf("// %u frame%s for " MODE_NAME ROW_ORDER " %dx%d, gamma %.2f, %s dithering, made with extras/image-convert\n",
+           count, count == 1 ? "" : "s", IMAGE_X, PANEL_Y, options.gamma, options.dither);
+#ifdef PANEL_FLASH_RLE
+    const size_t length = flashRleEncodeAnimation(frames, count, PANEL_X, PANEL_Y, encoded);
+    printf("// run length encoded, %zu bytes instead of %zu\n", length, (size_t)count * FRAME_BYTES);
+    printf("const unsigned char %s[%zu] PROGMEM = {\n", options.name, length);
+    printBytes(encoded, length, "    ");
+    printf("};\n");
+    if (count > 1)
+    {
+        printf("const AnimationFrame %s_frames[%u] PROGMEM = {\n", options.name, count);
+        for (uint8_t i = 0; i < count; i++)
+        {
+            printf("    {%s + %zu, %d},\n", options.name, i * FLASH_RLE_TABLE_SIZE(PANEL_Y), options.duration);
+        }
+        printf("};\n");
+    }
+    fprintf(stderr, "%zu bytes run length encoded (%.1f%%)\n", length, 100.0 * length / (count * FRAME_BYTES));
+    free(encoded);
+#else
+    if (count == 1)
+    {
+        printf("const unsigned char %s[%u] PROGMEM = {\n", options.name, (unsigned)FRAME_BYTES);
+        printBytes(frames[0], FRAME_BYTES, "    ");
+        printf("};\n");
+    }
+    else
+    {
+        printf("const unsigned char %s[%u][%u] PROGMEM = {\n", options.name, count, (unsigned)FRAME_BYTES);
+        for (uint8_t i = 0; i < count; i++)
+        {
+            printf("    {\n");
+            printBytes(frames[i], FRAME_BYTES, "        ");
+            printf("    },\n");
+        }
+        printf("};\n");
+#ifdef PANEL_FLASH
+        printf("const AnimationFrame %s_frames[%u] PROGMEM = {\n", options.name, count);
+        for (uint8_t i = 0; i < count; i++)
+        {
+            printf("    {%s[%u], %d},\n", options.name, i, options.duration);
+        }
+        printf("};\n");
+#endif
+    }
+#endif
+    return true;
+}
+
+// shows the first frame on the simulated panel and writes what it lit
+bool writePreview(const uint8_t *frame, const char *path)
+{
+#ifdef PANEL_FLASH_RLE
+    static uint8_t encoded[FLASH_RLE_MAX_SIZE(PANEL_X, PANEL_Y)];
+    flashRleEncode(frame, PANEL_X, PANEL_Y, encoded);
+    panel.buffer = encoded;
+#else
+#ifdef PANEL_FLASH
+    memcpy(preview, frame, FRAME_BYTES);
+#else
+    panel.loadBuffer(frame);
+#endif
+#endif
+    panel.displayBuffer();
+    virtual_panel.beginFrame();
+    panel.displayBuffer();
+    return virtual_panel.writePPM(path);
+}
+
+int usage(const char *program)
+{
+    fprintf(stderr, "usage: %s [--name name] [--gamma g] [--dither floyd|atkinson|none] [--duration ms] [--preview file.ppm] frame.png|frame.ppm ...\n", program);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    Options options = {"image", 2.2f, floyd, 4, 16, "floyd", 100, nullptr};
+    uint8_t *frames[MAX_FRAMES];
+    uint8_t count = 0;
+    static uint8_t levels[IMAGE_X * PANEL_Y * 3];
+    for (int i = 1; i < argc; i++)
+    {
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (strcmp(argv[i], "--name") == 0 && value)
+        {
+            options.name = value;
+        }
+        else if (strcmp(argv[i], "--gamma") == 0 && value && atof(value) > 0)
+        {
+            options.gamma = atof(value);
+        }
+        else if (strcmp(argv[i], "--duration") == 0 && value && atoi(value) >= 0 && atoi(value) <= 65535)
+        {
+            options.duration = atoi(value);
+        }
+        else if (strcmp(argv[i], "--preview") == 0 && value)
+        {
+            options.preview = value;
+        }
+        else if (strcmp(argv[i], "--dither") == 0 && value)
+        {
+            options.dither = value;
+            if (strcmp(value, "floyd") == 0)
+            {
+                options.kernel = floyd;
+                options.kernel_length = 4;
+                options.divisor = 16;
+            }
+            else if (strcmp(value, "atkinson") == 0)
+            {
+                options.kernel = atkinson;
+                options.kernel_length = 6;
+                options.divisor = 8;
+            }
+            else if (strcmp(value, "none") == 0)
+            {
+                options.kernel_length = 0;
+            }
+            else
+            {
+                return usage(argv[0]);
+            }
+        }
+        else if (argv[i][0] == '-' || count == MAX_FRAMES)
+        {
+            return usage(argv[0]);
+        }
+        else
+        {
+            Image image;
+            const char *error = readImage(argv[i], image);
+            if (error)
+            {
+                fprintf(stderr, "%s: %s\n", argv[i], error);
+                return 1;
+            }
+            if (image.width != IMAGE_X || image.height != PANEL_Y)
+            {
+                fprintf(stderr, "%s: %ux%u, this build takes %dx%d frames\n", argv[i], image.width, image.height, IMAGE_X, PANEL_Y);
+                return 1;
+            }
+            quantize(image, options, levels);
+            frames[count] = (uint8_t *)calloc(1, FRAME_BYTES);
+            if (!frames[count])
+            {
+                fprintf(stderr, "%s: out of memory\n", argv[i]);
+                return 1;
+            }
+            pack(levels, frames[count++]);
+            continue;
+        }
+        // the option took the next argument
+        i++;
+    }
+    if (count == 0)
+    {
+        return usage(argv[0]);
+    }
+
+    if (!printFrames(frames, count, options))
+    {
+        fprintf(stderr, "out of memory for the run length encoding of %u frames\n", count);
+        return 1;
+    }
+    if (options.preview && !writePreview(frames[0], options.preview))
+    {
+        fprintf(stderr, "%s: cannot write the preview\n", options.preview);
+        return 1;
+    }
+    for (uint8_t i = 0; i < count; i++)
+    {
+        free(frames[i]);
+    }
+    return 0;
+}
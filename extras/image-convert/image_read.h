@@ -0,0 +1,553 @@
+// reads ppm and png files into 8 bit rgb, for the pc, used by image-convert.cpp
+// ppm: P3 and P6 with any maxval, png: every color type and bit depth without interlacing, alpha is laid over black
+// the png data is inflated here, so the converter needs nothing but a c++ compiler
+#ifndef HUB75NANO_IMAGE_READ_H
+#define HUB75NANO_IMAGE_READ_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <vector>
+
+typedef struct Image
+{
+    uint16_t width;
+    uint16_t height;
+    std::vector<uint8_t> rgb; // width * height * 3 bytes, row after row
+} Image;
+
+#pragma region inflate
+
+// a canonical huffman code, count[length] codes of each length and their symbols in code order
+typedef struct Huffman
+{
+    uint16_t count[16];
+    uint16_t symbol[320];
+} Huffman;
+
+typedef struct Inflater
+{
+    const uint8_t *in;
+    size_t length;
+    size_t position;
+    uint32_t bits;
+    uint8_t bit_count;
+    bool failed;
+    std::vector<uint8_t> out;
+} Inflater;
+
+inline uint32_t _inflateBits(Inflater &s, uint8_t need)
+{
+    while (s.bit_count < need)
+    {
+        if (s.position == s.length)
+        {
+            s.failed = true;
+            return 0;
+        }
+        s.bits |= (uint32_t)s.in[s.position++] << s.bit_count;
+        s.bit_count += 8;
+    }
+    const uint32_t value = s.bits & ((1UL << need) - 1);
+    s.bits >>= need;
+    s.bit_count -= need;
+    return value;
+}
+
+// false if the lengths do not make a code
+inline bool _huffmanBuild(Huffman &h, const uint8_t *lengths, uint16_t n)
+{
+    memset(h.count, 0, sizeof(h.count));
+    for (uint16_t i = 0; i < n; i++)
+    {
+        h.count[lengths[i]]++;
+    }
+    h.count[0] = 0;
+    int left = 1;
+    for (uint8_t length = 1; length < 16; length++)
+    {
+        left = (left << 1) - h.count[length];
+        if (left < 0)
+        {
+            return false;
+        }
+    }
+    uint16_t offsets[16];
+    offsets[1] = 0;
+    for (uint8_t length = 1; length < 15; length++)
+    {
+        offsets[length + 1] = offsets[length] + h.count[length];
+    }
+    for (uint16_t i = 0; i < n; i++)
+    {
+        if (lengths[i] != 0)
+        {
+            h.symbol[offsets[lengths[i]]++] = i;
+        }
+    }
+    return true;
+}
+
+// the codes are stored msb first, one bit at a time keeps it short
+inline int _huffmanDecode(Inflater &s, const Huffman &h)
+{
+    int code = 0, first = 0, index = 0;
+    for (uint8_t length = 1; length < 16; length++)
+    {
+        code |= (int)_inflateBits(s, 1);
+        const int count = h.count[length];
+        if (code - count < first)
+        {
+            return h.symbol[index + (code - first)];
+        }
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+    s.failed = true;
+    return -1;
+}
+
+inline bool _inflateCodes(Inflater &s, const Huffman &lengths, const Huffman &distances)
+{
+    static const uint16_t length_base[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    static const uint8_t length_extra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    static const uint16_t distance_base[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+    static const uint8_t distance_extra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+    while (!s.failed)
+    {
+        int symbol = _huffmanDecode(s, lengths);
+        if (symbol < 0 || symbol > 285 || (symbol > 256 && symbol - 257 >= 29))
+        {
+            return false;
+        }
+        if (symbol < 256)
+        {
+            s.out.push_back((uint8_t)symbol);
+            continue;
+        }
+        if (symbol == 256)
+        {
+            return true;
+        }
+        symbol -= 257;
+        const size_t length = length_base[symbol] + _inflateBits(s, length_extra[symbol]);
+        const int distance_symbol = _huffmanDecode(s, distances);
+        if (distance_symbol < 0 || distance_symbol >= 30)
+        {
+            return false;
+        }
+        const size_t distance = distance_base[distance_symbol] + _inflateBits(s, distance_extra[distance_symbol]);
+        if (distance > s.out.size())
+        {
+            return false;
+        }
+        // byte by byte, the copy may overlap what it writes
+        for (size_t i = 0; i < length; i++)
+        {
+            s.out.push_back(s.out[s.out.size() - distance]);
+        }
+    }
+    return false;
+}
+
+inline bool _inflateFixed(Inflater &s)
+{
+    uint8_t lengths[288];
+    memset(lengths, 8, 144);
+    memset(lengths + 144, 9, 112);
+    memset(lengths + 256, 7, 24);
+    memset(lengths + 280, 8, 8);
+    Huffman literals, distances;
+    _huffmanBuild(literals, lengths, 288);
+    memset(lengths, 5, 30);
+    _huffmanBuild(distances, lengths, 30);
+    return _inflateCodes(s, literals, distances);
+}
+
+inline bool _inflateDynamic(Inflater &s)
+{
+    static const uint8_t order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+    const uint16_t literal_count = _inflateBits(s, 5) + 257;
+    const uint16_t distance_count = _inflateBits(s, 5) + 1;
+    const uint16_t code_count = _inflateBits(s, 4) + 4;
+    uint8_t lengths[320] = {};
+    for (uint16_t i = 0; i < code_count; i++)
+    {
+        lengths[order[i]] = _inflateBits(s, 3);
+    }
+    Huffman code_lengths, literals, distances;
+    if (s.failed || !_huffmanBuild(code_lengths, lengths, 19))
+    {
+        return false;
+    }
+    memset(lengths, 0, 19);
+    uint16_t i = 0;
+    while (i < literal_count + distance_count && !s.failed)
+    {
+        const int symbol = _huffmanDecode(s, code_lengths);
+        if (symbol < 0)
+        {
+            return false;
+        }
+        if (symbol < 16)
+        {
+            lengths[i++] = symbol;
+            continue;
+        }
+        // 16 repeats the last length, 17 and 18 write zeros
+        uint8_t value = 0;
+        uint16_t repeat;
+        if (symbol == 16)
+        {
+            if (i == 0)
+            {
+                return false;
+            }
+            value = lengths[i - 1];
+            repeat = 3 + _inflateBits(s, 2);
+        }
+        else
+        {
+            repeat = symbol == 17 ? 3 + _inflateBits(s, 3) : 11 + _inflateBits(s, 7);
+        }
+        if (i + repeat > literal_count + distance_count)
+        {
+            return false;
+        }
+        while (repeat-- > 0)
+        {
+            lengths[i++] = value;
+        }
+    }
+    if (s.failed || lengths[256] == 0)
+    {
+        return false;
+    }
+    if (!_huffmanBuild(literals, lengths, literal_count) || !_huffmanBuild(distances, lengths + literal_count, distance_count))
+    {
+        return false;
+    }
+    return _inflateCodes(s, literals, distances);
+}
+
+// a zlib stream, the checksum is not looked at
+inline bool inflateZlib(const uint8_t *in, size_t length, std::vector<uint8_t> &out)
+{
+    if (length < 2 || (in[0] & 0x0F) != 8 || ((in[0] << 8) | in[1]) % 31 != 0 || (in[1] & 0x20))
+    {
+        return false;
+    }
+    Inflater s = {in, length, 2, 0, 0, false, {}};
+    bool last = false;
+    while (!last)
+    {
+        last = _inflateBits(s, 1);
+        const uint8_t type = _inflateBits(s, 2);
+        bool ok = false;
+        if (type == 0)
+        {
+            // stored, starts at the next byte
+            s.bits = 0;
+            s.bit_count = 0;
+            if (s.position + 4 <= s.length)
+            {
+                const uint16_t stored = s.in[s.position] | (s.in[s.position + 1] << 8);
+                const uint16_t check = s.in[s.position + 2] | (s.in[s.position + 3] << 8);
+                s.position += 4;
+                ok = (uint16_t)~check == stored && s.position + stored <= s.length;
+                if (ok)
+                {
+                    s.out.insert(s.out.end(), s.in + s.position, s.in + s.position + stored);
+                    s.position += stored;
+                }
+            }
+        }
+        else if (type == 1)
+        {
+            ok = _inflateFixed(s);
+        }
+        else if (type == 2)
+        {
+            ok = _inflateDynamic(s);
+        }
+        if (!ok || s.failed)
+        {
+            return false;
+        }
+    }
+    out.swap(s.out);
+    return true;
+}
+
+#pragma endregion // inflate
+
+#pragma region png
+
+inline uint32_t _bigEndian(const uint8_t *bytes)
+{
+    return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | bytes[3];
+}
+
+inline uint8_t _paeth(uint8_t a, uint8_t b, uint8_t c)
+{
+    const int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+}
+
+inline const char *_readPng(const std::vector<uint8_t> &file, Image &image)
+{
+    uint32_t width = 0, height = 0;
+    uint8_t depth = 0, type = 0;
+    uint8_t palette[256][4];
+    memset(palette, 255, sizeof(palette));
+    std::vector<uint8_t> compressed;
+    size_t position = 8;
+    while (position + 12 <= file.size())
+    {
+        const uint32_t length = _bigEndian(&file[position]);
+        const uint8_t *chunk = &file[position + 4];
+        const uint8_t *data = chunk + 4;
+        if (length > file.size() - position - 12)
+        {
+            return "png chunk runs past the end of the file";
+        }
+        if (memcmp(chunk, "IHDR", 4) == 0 && length >= 13)
+        {
+            width = _bigEndian(data);
+            height = _bigEndian(data + 4);
+            depth = data[8];
+            type = data[9];
+            if (data[12] != 0)
+            {
+                return "interlaced png files are not supported";
+            }
+        }
+        else if (memcmp(chunk, "PLTE", 4) == 0)
+        {
+            for (uint32_t i = 0; i < length / 3 && i < 256; i++)
+            {
+                memcpy(palette[i], data + i * 3, 3);
+            }
+        }
+        else if (memcmp(chunk, "tRNS", 4) == 0 && type == 3)
+        {
+            for (uint32_t i = 0; i < length && i < 256; i++)
+            {
+                palette[i][3] = data[i];
+            }
+        }
+        else if (memcmp(chunk, "IDAT", 4) == 0)
+        {
+            compressed.insert(compressed.end(), data, data + length);
+        }
+        else if (memcmp(chunk, "IEND", 4) == 0)
+        {
+            break;
+        }
+        position += 12 + length;
+    }
+    // gray, rgb, palette, gray + alpha, rgba
+    static const uint8_t channels_of[7] = {1, 0, 3, 1, 2, 0, 4};
+    if (width == 0 || height == 0 || width > 65535 || height > 65535 || type > 6 || channels_of[type] == 0)
+    {
+        return "png file without a usable header";
+    }
+    const uint8_t channels = channels_of[type];
+    if (!(depth == 8 || depth == 16 || ((type == 0 || type == 3) && (depth == 1 || depth == 2 || depth == 4))) || (type == 3 && depth == 16))
+    {
+        return "png bit depth not supported";
+    }
+    std::vector<uint8_t> raw;
+    const size_t stride = ((size_t)width * channels * depth + 7) / 8;
+    if (!inflateZlib(compressed.data(), compressed.size(), raw) || raw.size() < (stride + 1) * height)
+    {
+        return "png image data is damaged";
+    }
+
+    // undoes the filter of every row in place, bpp is the distance to the same byte of the pixel before
+    const size_t bpp = channels * depth >= 8 ? channels * depth / 8 : 1;
+    for (uint32_t y = 0; y < height; y++)
+    {
+        uint8_t *row = &raw[y * (stride + 1) + 1];
+        const uint8_t *up = y > 0 ? row - (stride + 1) : nullptr;
+        const uint8_t filter = row[-1];
+        for (size_t i = 0; i < stride; i++)
+        {
+            const uint8_t a = i >= bpp ? row[i - bpp] : 0, b = up ? up[i] : 0, c = up && i >= bpp ? up[i - bpp] : 0;
+            switch (filter)
+            {
+            case 0:
+                break;
+            case 1:
+                row[i] += a;
+                break;
+            case 2:
+                row[i] += b;
+                break;
+            case 3:
+                row[i] += (uint8_t)((a + b) / 2);
+                break;
+            case 4:
+                row[i] += _paeth(a, b, c);
+                break;
+            default:
+                return "png row filter not supported";
+            }
+        }
+    }
+
+    image.width = width;
+    image.height = height;
+    image.rgb.assign((size_t)width * height * 3, 0);
+    for (uint32_t y = 0; y < height; y++)
+    {
+        const uint8_t *row = &raw[y * (stride + 1) + 1];
+        for (uint32_t x = 0; x < width; x++)
+        {
+            // the samples of the pixel as 8 bit, 16 bit keeps its high byte
+            uint8_t samples[4] = {0, 0, 0, 255};
+            for (uint8_t channel = 0; channel < channels; channel++)
+            {
+                const size_t bit = ((size_t)x * channels + channel) * depth;
+                if (depth >= 8)
+                {
+                    samples[channel] = row[bit / 8];
+                }
+                else
+                {
+                    const uint8_t value = (row[bit / 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1);
+                    samples[channel] = type == 3 ? value : value * 255 / ((1 << depth) - 1);
+                }
+            }
+            uint8_t rgba[4];
+            if (type == 3)
+            {
+                memcpy(rgba, palette[samples[0]], 4);
+            }
+            else if (channels <= 2)
+            {
+                rgba[0] = rgba[1] = rgba[2] = samples[0];
+                rgba[3] = channels == 2 ? samples[1] : 255;
+            }
+            else
+            {
+                memcpy(rgba, samples, 4);
+            }
+            uint8_t *pixel = &image.rgb[((size_t)y * width + x) * 3];
+            for (uint8_t c = 0; c < 3; c++)
+            {
+                pixel[c] = (uint8_t)((rgba[c] * rgba[3] + 127) / 255);
+            }
+        }
+    }
+    return nullptr;
+}
+
+#pragma endregion // png
+
+#pragma region ppm
+
+// the next number of a ppm header, skipping white space and comments
+inline long _ppmNumber(const std::vector<uint8_t> &file, size_t &position)
+{
+    while (position < file.size() && (isspace(file[position]) || file[position] == '#'))
+    {
+        if (file[position] == '#')
+        {
+            while (position < file.size() && file[position] != '\n')
+            {
+                position++;
+            }
+        }
+        else
+        {
+            position++;
+        }
+    }
+    if (position == file.size() || !isdigit(file[position]))
+    {
+        return -1;
+    }
+    long value = 0;
+    while (position < file.size() && isdigit(file[position]) && value < 1000000)
+    {
+        value = value * 10 + (file[position++] - '0');
+    }
+    return value;
+}
+
+inline const char *_readPpm(const std::vector<uint8_t> &file, Image &image)
+{
+    const bool binary = file[1] == '6';
+    size_t position = 2;
+    const long width = _ppmNumber(file, position);
+    const long height = _ppmNumber(file, position);
+    const long maxval = _ppmNumber(file, position);
+    if (width <= 0 || height <= 0 || width > 65535 || height > 65535 || maxval <= 0 || maxval > 65535)
+    {
+        return "ppm file without a usable header";
+    }
+    image.width = width;
+    image.height = height;
+    image.rgb.assign((size_t)width * height * 3, 0);
+    // one white space byte ends the header of a binary file
+    if (binary)
+    {
+        position++;
+    }
+    const uint8_t sample_bytes = maxval > 255 ? 2 : 1;
+    for (size_t i = 0; i < image.rgb.size(); i++)
+    {
+        long value;
+        if (binary)
+        {
+            if (position + sample_bytes > file.size())
+            {
+                return "ppm file is too short";
+            }
+            value = sample_bytes == 2 ? (file[position] << 8) | file[position + 1] : file[position];
+            position += sample_bytes;
+        }
+        else if ((value = _ppmNumber(file, position)) < 0)
+        {
+            return "ppm file is too short";
+        }
+        image.rgb[i] = (uint8_t)(((value < maxval ? value : maxval) * 255 + maxval / 2) / maxval);
+    }
+    return nullptr;
+}
+
+#pragma endregion // ppm
+
+// returns 0 or what went wrong
+inline const char *readImage(const char *path, Image &image)
+{
+    FILE *input = fopen(path, "rb");
+    if (!input)
+    {
+        return "cannot open the file";
+    }
+    std::vector<uint8_t> file;
+    uint8_t chunk[4096];
+    size_t read;
+    while ((read = fread(chunk, 1, sizeof(chunk), input)) > 0)
+    {
+        file.insert(file.end(), chunk, chunk + read);
+    }
+    fclose(input);
+    static const uint8_t png_signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    if (file.size() >= 8 && memcmp(file.data(), png_signature, 8) == 0)
+    {
+        return _readPng(file, image);
+    }
+    if (file.size() >= 2 && file[0] == 'P' && (file[1] == '3' || file[1] == '6'))
+    {
+        return _readPpm(file, image);
+    }
+    return "neither a png nor a P3 / P6 ppm file";
+}
+
+#endif // HUB75NANO_IMAGE_READ_H
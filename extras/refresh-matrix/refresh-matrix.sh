@@ -0,0 +1,56 @@
+#!/bin/sh
+# builds examples/refresh-benchmark for every mode on every chip, runs it in simavr and prints one markdown table
+# needs arduino-cli (with the arduino:avr core) and simavr, the library is taken from this checkout
+# every configuration is built twice, the plain build gives the timing and a PANEL_STATS build the OE duty
+# the PANEL_ASM_ROWS builds also measure one row of the asm shifter and fail if it misses its cycle budget
+# ./refresh-matrix.sh > table.md
+cd "$(dirname "$0")" || exit 1
+sketch=../../examples/refresh-benchmark
+library=../..
+build=$(mktemp -d)
+trap 'rm -rf "$build"' EXIT
+
+# fqbn and the chip name simavr wants
+chips="arduino:avr:nano,atmega328p arduino:avr:mega,atmega2560"
+# hub75e has no flash output (src/output/hub75e/flash_buffer.h is empty), so it is only measured with the 1 bit buffer
+modes="- -DPANEL_ASM_ROWS -DPANEL_BIG -DPANEL_FLASH -DPANEL_HUB75E"
+
+# prints the table row of one build, flags are separated by + so they stay one word
+run() {
+    fqbn=$1
+    mcu=$2
+    flags=$(echo "$3" | tr '+' ' ')
+    [ "$flags" = "-" ] && flags=""
+    out="$build/$(echo "$fqbn $3" | tr -c 'a-zA-Z0-9\n' '_')"
+    arduino-cli compile --fqbn "$fqbn" --library "$library" --build-property "build.extra_flags=$flags" \
+        --output-dir "$out" "$sketch" > "$out.log" 2>&1 || {
+        echo "build failed: $fqbn $flags, see $out.log" >&2
+        return 1
+    }
+    # the sketch prints everything in setup(), then only refreshes
+    timeout 30 simavr -m "$mcu" -f 16000000 "$out/refresh-benchmark.ino.elf" > "$out.txt" 2>&1
+    # the asm builds measure one row of the shifter, it has to take exactly PANEL_ASM_CYCLES_PER_ROW
+    grep -a -m 1 'asm row cycles:' "$out.txt" | awk -v build="$fqbn $flags" '{
+        sub(/.*asm row cycles: /, "")
+        split($0, cycles, /[^0-9]+/)
+        if (cycles[1] != cycles[2]) { printf("asm row of %s: %d cycles measured, the budget is %d\n", build, cycles[1], cycles[2]) > "/dev/stderr"; exit 1 }
+    }' || return 1
+    grep -a -m 1 '^| [^m-]' "$out.txt"
+}
+
+echo "| chip | mode | size | MAX_FRAMETIME | cycles/frame | refresh Hz | buffer bytes | flash bytes | static ram bytes | OE duty % |"
+echo "| ---- | ---- | ---- | ------------- | ------------ | ---------- | ------------ | ----------- | ---------------- | --------- |"
+failed=0
+for chip in $chips; do
+    fqbn=${chip%,*}
+    mcu=${chip#*,}
+    for mode in $modes; do
+        plain=$(run "$fqbn" "$mcu" "$mode") || { failed=1; continue; }
+        [ "$mode" = "-" ] && with_stats=-DPANEL_STATS || with_stats="${mode}+-DPANEL_STATS"
+        stats=$(run "$fqbn" "$mcu" "$with_stats" | awk -F'|' '{ gsub(/ /, "", $10); print $10 }')
+        [ -n "$plain" ] || { echo "no output: $fqbn $mode" >&2; failed=1; continue; }
+        # the plain row with the duty of the stats build in the last column
+        echo "$plain" | awk -F'|' -v chip="$mcu" -v duty="${stats:--}" 'BEGIN { OFS = "|" } { $10 = " " duty " "; print "| " chip " " $0 }'
+    done
+done
+exit $failed
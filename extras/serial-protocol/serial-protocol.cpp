@@ -0,0 +1,141 @@
+// checks the binary serial input against the stand-in serial port of the host board, built for the pc
+// g++ -std=gnu++17 -O2 -I<path to library>/src serial-protocol.cpp -o serial-protocol              (1 bit buffer, LED_short)
+// g++ -std=gnu++17 -O2 -I<path to library>/src -DPANEL_BIG serial-protocol.cpp -o serial-protocol  (2 bit buffer, LED_long)
+// the same random rectangle updates are sent at several baud rates while displayBuffer() runs, with and without flow control
+// with flow control the buffer has to end up like the updates say and no byte may be lost, the program returns 1 otherwise
+#define PANEL_HOST
+#define PANEL_SERIAL_INPUT
+#ifndef PANEL_X
+#define PANEL_X 64
+#endif
+#ifndef PANEL_Y
+#define PANEL_Y 32
+#endif
+#include "HUB75nano.h"
+
+#define UPDATES 300
+#define LEDS_PER_ROW (PANEL_CANVAS_X / 4)
+
+Panel panel = {};
+// the LED structs live inside Panel
+#define LED_BYTES sizeof(panel.buffer[0])
+
+// what the buffer should hold after all updates
+uint8_t expected[sizeof(panel.buffer)];
+// every packet of the run, back to back
+uint8_t stream[UPDATES * (6 + 2 * LEDS_PER_ROW * LED_BYTES * 4)];
+size_t stream_length = 0;
+
+// xorshift, so every run sends the same updates
+uint32_t random_state = 2463534242;
+uint8_t randomByte(uint8_t limit)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return (uint8_t)(random_state % limit);
+}
+
+// a rectangle of random bytes, sometimes reaching out of the buffer, and what it leaves in expected
+void addUpdate()
+{
+    const uint8_t x = randomByte(LEDS_PER_ROW + 2), y = randomByte(PANEL_Y / 2 + 2);
+    const uint8_t w = randomByte(LEDS_PER_ROW / 2) + 1, h = randomByte(4) + 1;
+    const uint8_t header[] = {PANEL_SERIAL_SYNC, PANEL_SERIAL_RECT, x, y, w, h};
+    memcpy(&stream[stream_length], header, sizeof(header));
+    stream_length += sizeof(header);
+    for (uint8_t line = 0; line < h; line++)
+    {
+        for (uint16_t column = 0; column < w * LED_BYTES; column++)
+        {
+            const uint8_t value = randomByte(255);
+            stream[stream_length++] = value;
+            const uint16_t led = x + column / LED_BYTES;
+            if (y + line < PANEL_Y / 2 && led < LEDS_PER_ROW)
+            {
+                expected[((y + line) * LEDS_PER_ROW + x) * LED_BYTES + column] = value;
+            }
+        }
+    }
+    // now and then a command the panel does not know, it has to wait for the next sync
+    if (randomByte(16) == 0)
+    {
+        stream[stream_length++] = PANEL_SERIAL_SYNC;
+        stream[stream_length++] = 'X';
+        stream[stream_length++] = 1;
+    }
+}
+
+typedef struct Result
+{
+    bool complete;
+    bool same;
+    uint32_t dropped;
+    uint32_t frames;
+    uint32_t us;
+    uint32_t stalled_us;
+} Result;
+
+Result run(unsigned long baud, bool flow_control)
+{
+    memset(panel.buffer, 0, sizeof(panel.buffer));
+    panel.serial_state = SERIAL_WAIT_SYNC;
+    panel.serial_unacked = 0;
+    Serial.begin(baud);
+    const uint32_t start = virtual_panel.ticks;
+    if (flow_control)
+    {
+        Serial.send(stream, stream_length, PANEL_SERIAL_WINDOW, PANEL_SERIAL_ACK_EVERY);
+    }
+    else
+    {
+        Serial.send(stream, stream_length);
+    }
+    Result result = {};
+    // the stream takes seconds, a frame is about a millisecond
+    while (result.frames < 200000 && !(Serial.sent_all() && Serial.available() == 0))
+    {
+        panel.displayBuffer();
+        result.frames++;
+    }
+    result.complete = Serial.sent_all();
+    result.same = memcmp(panel.buffer, expected, sizeof(expected)) == 0;
+    result.dropped = Serial.dropped;
+    result.us = (virtual_panel.ticks - start) / PANEL_HOST_TICKS_PER_US;
+    result.stalled_us = Serial.stalled_ticks / PANEL_HOST_TICKS_PER_US;
+    return result;
+}
+
+int main()
+{
+    for (uint16_t i = 0; i < UPDATES; i++)
+    {
+        addUpdate();
+    }
+#ifdef PANEL_BIG
+    printf("LED_long (2 bit), %dx%d, %u updates in %u bytes, %d bytes taken in per row\n\n", PANEL_X, PANEL_Y, UPDATES, (unsigned)stream_length, PANEL_SERIAL_BYTES_PER_ROW);
+#else
+    printf("LED_short (1 bit), %dx%d, %u updates in %u bytes, %d bytes taken in per row\n\n", PANEL_X, PANEL_Y, UPDATES, (unsigned)stream_length, PANEL_SERIAL_BYTES_PER_ROW);
+#endif
+    printf("| baud | flow control | dropped bytes | buffer | bytes/s | refresh while receiving | sender waited |\n");
+    printf("| ---- | ------------ | ------------- | ------ | ------- | ----------------------- | ------------- |\n");
+    const unsigned long bauds[] = {115200, 250000, 500000, 1000000, 2000000};
+    bool failed = false;
+    for (const unsigned long baud : bauds)
+    {
+        for (uint8_t flow = 0; flow < 2; flow++)
+        {
+            const bool flow_control = flow == 1;
+            const Result result = run(baud, flow_control);
+            printf("| %lu | %s | %u | %s | %u | %u Hz | %u%% |\n", baud, flow_control ? "yes" : "no", (unsigned)result.dropped,
+                   !result.complete ? "incomplete" : result.same ? "same" : "differs",
+                   (unsigned)((uint64_t)stream_length * 1000000 / result.us), (unsigned)((uint64_t)result.frames * 1000000 / result.us),
+                   (unsigned)((uint64_t)result.stalled_us * 100 / result.us));
+            if (flow_control && (!result.complete || !result.same || result.dropped != 0))
+            {
+                failed = true;
+            }
+        }
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,187 @@
+// feeds a recorded stream of whole frames through the stand-in serial port of the host board, built for the pc
+// g++ -std=gnu++17 -O2 -I<path to library>/src serial-stream.cpp -o serial-stream
+// every frame is sent back to back at line rate while displayBuffer() runs, each one has to be shown whole and in order,
+// every refresh has to latch all rows, the program returns 1 otherwise. the latency is from the last byte of a frame
+// on the wire to the start of the first refresh that shows it. at the end one more frame swaps the second buffer in
+// and the program draws on top of it, the drawing has to show up on the simulated panel
+#define PANEL_HOST
+#define PANEL_SERIAL_STREAM
+#ifndef PANEL_X
+#define PANEL_X 64
+#endif
+#ifndef PANEL_Y
+#define PANEL_Y 32
+#endif
+#include "HUB75nano.h"
+
+#define FRAMES 90
+#define FRAME_BYTES sizeof(panel.buffer)
+#define PACKET_BYTES (2 + FRAME_BYTES)
+
+Panel panel = {};
+
+// the recording, sync and command in front of every frame
+uint8_t stream[FRAMES * PACKET_BYTES];
+
+// xorshift, so every run sends the same frames
+uint32_t random_state = 2463534242;
+uint8_t randomByte()
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return (uint8_t)random_state;
+}
+
+const uint8_t *frame(uint16_t index)
+{
+    return &stream[index * PACKET_BYTES + 2];
+}
+
+typedef struct Result
+{
+    uint16_t shown;
+    uint16_t damaged;
+    uint32_t dropped;
+    uint32_t torn_refreshes;
+    uint32_t us;
+    uint32_t latency_sum;
+    uint32_t latency_max;
+    uint32_t refreshes;
+} Result;
+
+Result run(unsigned long baud, bool flow_control)
+{
+    memset(panel.buffer, 0, sizeof(panel.buffer));
+    memset(panel.stream_buffer, 0, sizeof(panel.stream_buffer));
+    panel.serial_state = SERIAL_WAIT_SYNC;
+    panel.serial_unacked = 0;
+    panel.stream_ready = false;
+    panel.streamed_frames = 0;
+    Serial.begin(baud);
+    const uint32_t start = virtual_panel.ticks;
+    if (flow_control)
+    {
+        Serial.send(stream, sizeof(stream), PANEL_SERIAL_WINDOW, PANEL_SERIAL_ACK_EVERY);
+    }
+    else
+    {
+        Serial.send(stream, sizeof(stream));
+    }
+    // without flow control the wire never waits, so the last byte of frame k is there after (k + 1) packets
+    const double ticks_per_byte = 10.0 * PANEL_HOST_TICKS_PER_US * 1000000.0 / baud;
+    Result result = {};
+    while (result.refreshes < 200000 && result.shown < FRAMES)
+    {
+        const uint32_t before = virtual_panel.ticks;
+        const uint32_t latches = virtual_panel.latches;
+        const uint16_t streamed = panel.streamed_frames;
+        panel.displayBuffer();
+        result.refreshes++;
+        if (virtual_panel.latches - latches != PANEL_Y / 2)
+        {
+            result.torn_refreshes++;
+        }
+        if (panel.streamed_frames == streamed)
+        {
+            continue;
+        }
+        // a new frame, it has to be the next one and whole
+        if (memcmp(panel.front_buffer, frame(result.shown), FRAME_BYTES) != 0)
+        {
+            result.damaged++;
+        }
+        if (!flow_control)
+        {
+            const uint32_t arrived = start + (uint32_t)((result.shown + 1) * PACKET_BYTES * ticks_per_byte);
+            const uint32_t latency = (before - arrived) / PANEL_HOST_TICKS_PER_US;
+            result.latency_sum += latency;
+            result.latency_max = max(result.latency_max, latency);
+        }
+        result.shown++;
+    }
+    result.dropped = Serial.dropped;
+    result.us = (virtual_panel.ticks - start) / PANEL_HOST_TICKS_PER_US;
+    return result;
+}
+
+// the color the simulated panel shows at x, y, rgb bits 0-2
+uint8_t shownColor(uint8_t x, uint8_t y)
+{
+    static uint8_t rgb[PANEL_E_Y * PANEL_E_X * 3];
+    virtual_panel.toRGB(rgb);
+    const uint8_t *pixel = &rgb[((uint16_t)y * PANEL_E_X + x) * 3];
+    return (pixel[0] != 0) | (pixel[1] != 0) << 1 | (pixel[2] != 0) << 2;
+}
+
+// streams one more frame, so the second buffer is shown, then draws and checks what the panel shows
+bool drawAfterStream()
+{
+    panel.serial_state = SERIAL_WAIT_SYNC;
+    panel.stream_ready = false;
+    Serial.begin(1000000);
+    Serial.send(stream, PACKET_BYTES);
+    const uint16_t streamed = panel.streamed_frames;
+    for (uint16_t refreshes = 0; refreshes < 1000 && panel.streamed_frames == streamed; refreshes++)
+    {
+        panel.displayBuffer();
+    }
+    const bool second_shown = panel.front_buffer == panel.stream_buffer;
+    panel.clearBuffer();
+    panel.fillRect(8, 4, 23, 11, Colors::RED);
+    panel.setBuffer(40, 20, Colors::GREEN);
+    panel.drawLine(0, 31, 63, 31, Colors::BLUE);
+    panel.displayBuffer();
+    virtual_panel.beginFrame();
+    panel.displayBuffer();
+    const bool drawn = shownColor(8, 4) == 1 && shownColor(23, 11) == 1 && shownColor(40, 20) == 2 && shownColor(63, 31) == 4 &&
+                       shownColor(0, 0) == 0 && shownColor(24, 11) == 0;
+    printf("\ndrawing after an odd number of streamed frames (second buffer shown: %s): %s\n", second_shown ? "yes" : "no", drawn ? "visible" : "NOT VISIBLE");
+    return second_shown && drawn;
+}
+
+int main()
+{
+    for (uint16_t i = 0; i < FRAMES; i++)
+    {
+        stream[i * PACKET_BYTES] = PANEL_SERIAL_SYNC;
+        stream[i * PACKET_BYTES + 1] = PANEL_SERIAL_FRAME;
+        for (uint16_t byte = 0; byte < FRAME_BYTES; byte++)
+        {
+            stream[i * PACKET_BYTES + 2 + byte] = randomByte();
+        }
+    }
+    printf("LED_short (1 bit), %dx%d, %u frames of %u bytes, %d bytes taken in per row\n\n", PANEL_X, PANEL_Y, FRAMES, (unsigned)FRAME_BYTES, PANEL_SERIAL_BYTES_PER_ROW);
+    printf("| baud | flow control | frames shown | fps | dropped bytes | damaged frames | torn refreshes | latency avg/max | refresh while streaming |\n");
+    printf("| ---- | ------------ | ------------ | --- | ------------- | -------------- | -------------- | --------------- | ----------------------- |\n");
+    const unsigned long bauds[] = {230400, 250000, 500000, 1000000};
+    bool failed = false;
+    for (const unsigned long baud : bauds)
+    {
+        for (uint8_t flow = 0; flow < 2; flow++)
+        {
+            const bool flow_control = flow == 1;
+            const Result result = run(baud, flow_control);
+            printf("| %lu | %s | %u | %.2f | %u | %u | %u |", baud, flow_control ? "yes" : "no", result.shown,
+                   result.shown * 1000000.0 / result.us, (unsigned)result.dropped, result.damaged, (unsigned)result.torn_refreshes);
+            if (flow_control)
+            {
+                printf(" - |");
+            }
+            else
+            {
+                printf(" %u/%u us |", (unsigned)(result.shown ? result.latency_sum / result.shown : 0), (unsigned)result.latency_max);
+            }
+            printf(" %u Hz |\n", (unsigned)((uint64_t)result.refreshes * 1000000 / result.us));
+            if (result.shown != FRAMES || result.damaged != 0 || result.dropped != 0 || result.torn_refreshes != 0)
+            {
+                failed = true;
+            }
+        }
+    }
+    if (!drawAfterStream())
+    {
+        failed = true;
+    }
+    return failed ? 1 : 0;
+}
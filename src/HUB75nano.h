@@ -16,7 +16,11 @@
 */
 #ifndef HUB75NANO_MAIN_H
 #define HUB75NANO_MAIN_H
+#ifdef PANEL_HOST
+#include "boards/host/host_arduino.h"
+#else
 #include <Arduino.h>
+#endif
 
 #include "Settings.h"
 
@@ -25,6 +29,12 @@
 // buffer toggle
 #ifdef PANEL_NO_BUFFER
 #undef PANEL_FLASH
+#undef PANEL_FLASH_OVERLAY
+#undef PANEL_FLASH_RLE
+#undef PANEL_TEXT_MODE
+#undef PANEL_PALETTE
+#undef PANEL_SERIAL_INPUT
+#undef PANEL_SERIAL_STREAM
 #undef PANEL_BIG
 #undef PANEL_SMALL_BRIGHT
 #undef PANEL_HIGH_RES
@@ -32,10 +42,68 @@
 #endif
 
 // flash toggle
+#ifdef PANEL_FLASH_OVERLAY
+#ifdef PANEL_HUB75E
+#error "The flash overlay is only available on hub75 panels"
+#endif
+#ifdef PANEL_FLASH_RLE
+#error "The flash overlay needs the plain flash image, not the run length encoded one"
+#endif
+#endif
+#ifdef PANEL_FLASH_RLE
+#ifdef PANEL_HUB75E
+#error "The run length encoded flash images are only available on hub75 panels"
+#endif
+#endif
 #ifdef PANEL_FLASH
 #undef PANEL_BIG
 #endif
 
+// text mode toggle
+#ifdef PANEL_TEXT_MODE
+#if defined(PANEL_BIG) || defined(PANEL_FLASH)
+#error "The text mode is only available with the 1 bit output"
+#endif
+#if PANEL_CANVAS_X != PANEL_X
+#error "The text mode has no viewport into a wider buffer"
+#endif
+#endif
+
+// palette mode toggle
+#ifdef PANEL_PALETTE
+#if defined(PANEL_BIG) || defined(PANEL_FLASH) || defined(PANEL_TEXT_MODE)
+#error "The palette mode is a buffer of its own, it cannot be combined with the 2 bit, flash or text mode"
+#endif
+#ifdef PANEL_HUB75E
+#error "The palette mode is only available on hub75 panels"
+#endif
+#if PANEL_CANVAS_X != PANEL_X
+#error "The palette mode has no viewport into a wider buffer"
+#endif
+#endif
+
+// serial input toggle
+#ifdef PANEL_SERIAL_INPUT
+#if defined(PANEL_FLASH) || defined(PANEL_TEXT_MODE) || defined(PANEL_PALETTE)
+#error "The serial input copies LED structs, it needs the 1 or 2 bit buffer"
+#endif
+#ifdef PANEL_HUB75E
+#error "The serial input is only available on hub75 panels"
+#endif
+#endif
+#ifdef PANEL_SERIAL_STREAM
+#ifdef PANEL_BIG
+#error "The serial stream needs two buffers, it is only available with the 1 bit buffer"
+#endif
+#endif
+// the LED buffer that is shown, everything that draws writes this one
+// with the serial stream that is whichever of the two buffers front_buffer points at after the last swap
+#ifdef PANEL_SERIAL_STREAM
+#define PANEL_SHOWN_BUFFER front_buffer
+#else
+#define PANEL_SHOWN_BUFFER ((LED *)buffer)
+#endif
+
 // hub75e 1bit bright mode
 #ifdef PANEL_SMALL_BRIGHT
 #ifdef PANEL_BIG
@@ -57,6 +125,19 @@
 #endif
 #endif
 
+// wider buffer than the panel
+#if PANEL_CANVAS_X != PANEL_X
+#if PANEL_CANVAS_X < PANEL_X || PANEL_CANVAS_X > 256 || PANEL_CANVAS_X % 4 != 0
+#error "PANEL_CANVAS_X has to be a multiple of 4 between PANEL_X and 256"
+#endif
+#ifdef PANEL_HUB75E
+#error "The viewport into a wider buffer is only available on hub75 panels"
+#endif
+#ifdef PANEL_FLASH
+#error "The viewport into a wider buffer is only available with the ram buffers"
+#endif
+#endif
+
 // hub75e high res mode toggle
 #ifdef PANEL_HIGH_RES
 #ifdef PANEL_BIG
@@ -71,7 +152,7 @@
 #ifdef PANEL_BIG
 #define MAX_COLORDEPTH 2
 #else
-#ifdef PANEL_FLASH
+#if defined(PANEL_FLASH) || defined(PANEL_PALETTE)
 #define MAX_COLORDEPTH 4
 #else
 #ifdef PANEL_NO_BUFFER
@@ -90,6 +171,14 @@
 // include colors
 #include "structs/Colors.h"
 
+#ifdef PANEL_STATS
+#include "structs/PanelStats.h"
+#endif
+
+#ifdef PANEL_FLASH
+#include "structs/AnimationFrame.h"
+#endif
+
 // toggle is in there, decided by the definitions we set before the include
 #include "fonts/font_common.h"
 
@@ -166,17 +255,40 @@ public:
         buffer = newBuffer;
     }
 #else
-#ifndef PANEL_NO_BUFFER
+#if !defined(PANEL_NO_BUFFER) && !defined(PANEL_TEXT_MODE)
 #include "structs/LED.h"
     void swapBuffer(const LED *newBuffer, uint8_t bufferLength)
     {
-        memcpy(buffer, newBuffer, bufferLength);
+        memcpy(PANEL_SHOWN_BUFFER, newBuffer, bufferLength);
+        // the copy starts at the first row
+        row_origin = 0;
+    }
+
+    // copies a whole buffer from flash, like the images extras/image-convert writes
+    void loadBuffer(PGM_VOID_P image)
+    {
+        memcpy_P(PANEL_SHOWN_BUFFER, image, sizeof(buffer));
+        row_origin = 0;
     }
 
     __attribute__((always_inline)) inline void fillBuffer(Color color)
     {
-        // fills the buffer
-        fillRect(0, 0, PANEL_X - 1, PANEL_Y - 1, color);
+        // fills the buffer with the repeating pattern of the color
+        fillRows(0, PANEL_Y - 1, color);
+    }
+
+    __attribute__((always_inline)) inline void clearBuffer()
+    {
+        // all bits off is black, with the palette buffer it is index 0 and shows whatever setPalette(0, ...) set
+        for (uint8_t y = 0; y < PANEL_Y; y++)
+        {
+#ifdef PANEL_PALETTE
+            PANEL_DRAW_HOOK(0, y, PANEL_CANVAS_X, Colors::INDEX_0);
+#else
+            PANEL_DRAW_HOOK(0, y, PANEL_CANVAS_X, Colors::BLACK);
+#endif
+        }
+        memset(PANEL_SHOWN_BUFFER, 0, sizeof(buffer));
     }
 #endif
 #endif
@@ -184,13 +296,21 @@ public:
 
 // only include the buffer stuff if we are not in immediate mode
 #ifndef PANEL_NO_BUFFER
+#ifdef PANEL_TEXT_MODE
+// the cells replace the pixel buffer, there is nothing to draw into
+#include "buffer_setting/text_buffer_setting.h"
+#else
 #include "buffer_setting/buffer.h"
-// include drawing code if we want it
-#ifndef PANEL_FLASH
+// include drawing code if we want it, with the flash buffer it draws into the overlay
+#if !defined(PANEL_FLASH) || defined(PANEL_FLASH_OVERLAY)
 #include "drawing/drawing.h"
 #endif
 #endif
+#endif
 
 #include "output/output.h"
 };
+
+// fails the build if the config does not fit the board
+#include "boards/budget.h"
 #endif // HUB75NANO_MAIN_H
\ No newline at end of file
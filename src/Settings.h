@@ -11,15 +11,30 @@
 // #define PANEL_3_PIN_ROWS // swaps the row addressing in from 5(binary) pin to 3 pin(shift register)
 // #define PANEL_BIG // use 2 bit rgb image buffer
 // #define PANEL_FLASH // 4 bit flash buffer
+// #define PANEL_FLASH_OVERLAY // flash buffer with a 1 bit ram overlay in one color on top, the drawing functions draw into the overlay
+// #define PANEL_FLASH_RLE // run length encoded flash images (extras/flash-rle converts them) with an offset per row, hub75 only
+// #define PANEL_PALETTE // 2 bit indexed ram buffer, the 4 indices show 4 bit per channel colors set with setPalette, hub75 only
 // #define PANEL_NO_BUFFER // no buffer, immediate mode only
+// #define PANEL_TEXT_MODE // character cells with a color each instead of a pixel buffer, the rows are rendered from the tiles while shifting
+// #define PANEL_TILE_Y 6 // tile height in the text mode, tiles are always 4 pixels wide
 // #define PANEL_NO_FONT // disables everything font related, saves some flash
+// #define PANEL_FONT 0 // 0 the 3x5 font, 1 the 5x7 font of Adafruit_GFX, 2 proportional GFXfonts picked with setFont()
 // #define PANEL_MAX_SPEED // uses more space but is faster, usually not needed
+// #define PANEL_ASM_ROWS // hand scheduled assembly row shifter for the 1 bit buffer, fixed 34 (atmega328) or 41 (atmega2560) cycles per 4 pixels
+// #define PANEL_STATS // collects refresh statistics (frame times, row times, OE duty), read them with panel.stats()
+// #define PANEL_SERIAL_INPUT // rectangle updates in the buffer layout over Serial, taken in between rows, hub75 with the 1 or 2 bit buffer only
+// #define PANEL_SERIAL_BYTES_PER_ROW 8 // most bytes the serial input takes in after a row, more is faster but lights that row longer
+// #define PANEL_SERIAL_STREAM // whole frames over Serial into a second 1 bit buffer, shown from the next refresh on, hub75 only
+// #define PANEL_MIN_REFRESH 30 // the build fails if the estimated refresh rate (boards/budget.h) is lower, off (0) unless set
+// #define PANEL_RAM_RESERVE 384 // ram that has to stay free next to the panel buffer, the build fails otherwise
 // #define PANEL_FLIP_VERTICAL // flips the panel vertically (in flash mode it flips the upper and lower half, but doesnt flip the whole panel)
 // #define PANEL_FLIP_HORIZONTAL // flips the panel horizontally
 // #define PANEL_X 64 // width in pixels
 // #define PANEL_Y 32 // panel height in pixels
+// #define PANEL_CANVAS_X 128 // width of the ram buffer, wider than the panel it is shown through a viewport (setViewport), hub75 only
 // #define PANEL_MAX_FRAMETIME 127 // shades all colors, should be of the form of (2^n - 1)
 // #define PANEL_COLOR_INVERSION //swaps red and blue
+// #define PANEL_HOST // compiles for a pc and drives the simulated panel in boards/host instead of pins
 /////////////////////
 
 // board size (currently max 1 board supported)
@@ -30,19 +45,63 @@
 #define PANEL_Y 32
 #endif
 
+// the ram buffer can be wider than the panel
+#ifndef PANEL_CANVAS_X
+#define PANEL_CANVAS_X PANEL_X
+#endif
+
 // sleep for brightnesses
 #ifndef MAX_FRAMETIME
 #define MAX_FRAMETIME 127
 #endif
 
+// the overlay sits on top of the flash buffer, the run length encoded images replace it
+#if defined(PANEL_FLASH_OVERLAY) || defined(PANEL_FLASH_RLE)
+#ifndef PANEL_FLASH
+#define PANEL_FLASH
+#endif
+#endif
+
 #ifdef PANEL_FLASH
 // have it bigger a size as we have more available lol
 #define PANEL_BUFFERSIZE (PANEL_X * PANEL_Y * 2) // 4 byte per led, we have 6 bit per 2 led per color depth -> about 4k
 #endif
 
+// palette mode, 2 bits per pixel, the upper and lower half of a column share a nibble
+#ifdef PANEL_PALETTE
+#define PANEL_BUFFERSIZE (PANEL_X * PANEL_Y / 4)
+#endif
+
+// text mode, only the row that is shifted out next is kept as pixels
+#ifdef PANEL_TEXT_MODE
+#ifndef PANEL_TILE_Y
+#define PANEL_TILE_Y 6
+#endif
+#define PANEL_TEXT_COLS (PANEL_X / 4)
+#define PANEL_TEXT_ROWS (PANEL_Y / PANEL_TILE_Y)
+#define PANEL_BUFFERSIZE (PANEL_X / 4)
+#endif
+
+// the stream comes in through the serial input
+#ifdef PANEL_SERIAL_STREAM
+#ifndef PANEL_SERIAL_INPUT
+#define PANEL_SERIAL_INPUT
+#endif
+#endif
+
+// serial input, the port can be any stream with available(), read() and write()
+#ifdef PANEL_SERIAL_INPUT
+#ifndef PANEL_SERIAL_PORT
+#define PANEL_SERIAL_PORT Serial
+#endif
+#ifndef PANEL_SERIAL_BYTES_PER_ROW
+#define PANEL_SERIAL_BYTES_PER_ROW 8
+#endif
+#endif
+
 // standard LED struct buffer
 #ifndef PANEL_BUFFERSIZE
-#define PANEL_BUFFERSIZE (PANEL_X * PANEL_Y / 8)
+#define PANEL_BUFFERSIZE (PANEL_CANVAS_X * PANEL_Y / 8)
 #endif
 
 #ifdef PANEL_HUB75E
@@ -1,15 +1,19 @@
 #ifndef HUB75NANO_BOARD_H
 #define HUB75NANO_BOARD_H
 
+#ifdef PANEL_HOST
+#include "boards/host/host_arduino.h"
+#else
 #include <Arduino.h>
+#endif
 
 // check we are on uno or nano, get pinout and how we access them
 // mini pro is the exact same as nano
+#ifdef PANEL_HOST // simulated panel on a pc
+#include "boards/host/host.h"
+#else
 #ifdef ARDUINO_AVR_NANO || defined(ARDUINO_AVR_PRO) // nano avr 328p
 #include "boards/nano/nano.h"
-#if PANEL_X * PANEL_Y > 4096
-#pragma GCC warning "this panel size may be too large for the mighty nano ram, please choose a smaller size and let the library simulate bigger pixels"
-#endif
 #else
 #ifdef ARDUINO_AVR_UNO &&defined(__AVR_ATmega328P__)
 #include "boards/uno/uno.h"
@@ -41,6 +45,7 @@
 #endif
 #endif
 #endif
+#endif
 
 #ifndef PANEL_X
 #error "Panel size needs to be defined"
@@ -124,4 +129,12 @@
 #error "this needs to be set for the selected board first"
 #endif
 
+// only the simulated panel looks at the draw calls
+#ifndef PANEL_DRAW_HOOK
+#define PANEL_DRAW_HOOK(x, y, len, color)
+#endif
+#ifndef PANEL_MASKED_HOOK
+#define PANEL_MASKED_HOOK(x, y, mask, color)
+#endif
+
 #endif // HUB75NANO_BOARD_H
\ No newline at end of file
@@ -18,6 +18,9 @@
 
 // include the relevant file to get the thingies
 // mini pro is the exact same as nano
+#ifdef PANEL_HOST // simulated panel on a pc
+#include "boards/host/host_methods.h"
+#else
 #ifdef ARDUINO_AVR_NANO || defined(ARDUINO_AVR_PRO) // nano with avr 328p
 #include "boards/nano/nano_methods.h"
 #else
@@ -51,6 +54,7 @@
 #endif
 #endif
 #endif
+#endif
 
 #ifndef HIGH_CLK
 #error "this needs to be set for the selected board first"
@@ -90,10 +94,6 @@
 #pragma GCC warning "No LATCH_GCLK defined for this board, using slower substitute"
 #endif
 
-#ifndef OVERFLOW
-#error "this needs to be set for the selected board first"
-#endif
-
 #ifndef set_pin_output
 #error "this needs to be set for the selected board first"
 #endif
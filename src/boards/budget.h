@@ -0,0 +1,139 @@
+#ifndef HUB75NANO_BUDGET_H
+#define HUB75NANO_BUDGET_H
+
+#include "../Settings.h"
+
+// compile time estimate of what the selected board, mode and size cost, so a config that does not fit fails when compiling
+// the board headers set PANEL_BOARD_RAM and PANEL_CYCLES_PER_PIXEL (one pixel of the 1 bit buffer shifted out in c)
+// the cycle numbers are rough, use examples/refresh-benchmark to measure the real thing
+
+// refresh rate below which the build fails, off by default since the cycle numbers are only estimates
+#ifndef PANEL_MIN_REFRESH
+#define PANEL_MIN_REFRESH 0
+#endif
+
+// ram left for the stack, serial buffers and the sketch itself
+#ifndef PANEL_RAM_RESERVE
+#define PANEL_RAM_RESERVE 384
+#endif
+
+// latch, row select and the loop around it
+#ifndef PANEL_CYCLES_PER_ROW
+#define PANEL_CYCLES_PER_ROW 64
+#endif
+
+#ifndef PANEL_BOARD_CLOCK
+#ifdef F_CPU
+#define PANEL_BOARD_CLOCK F_CPU
+#endif
+#endif
+
+#if defined(PANEL_BOARD_RAM) && defined(PANEL_CYCLES_PER_PIXEL) && defined(PANEL_BOARD_CLOCK)
+
+// cycles to shift out one row of one bit of color depth
+constexpr uint32_t panelPixelCycles()
+{
+#ifdef PANEL_ASM_CYCLES_PER_4_PIXELS
+    return PANEL_ASM_CYCLES_PER_4_PIXELS * (PANEL_E_X / 4);
+#else
+#ifdef PANEL_HUB75E
+#ifdef PANEL_TEXT_MODE
+    // the greyscale clock toggles with every data clock, every second row is rendered from the cells first
+    return (uint32_t)(PANEL_CYCLES_PER_PIXEL + 2) * PANEL_E_X + 8 * PANEL_X;
+#else
+    // the greyscale clock toggles with every data clock
+    return (uint32_t)(PANEL_CYCLES_PER_PIXEL + 2) * PANEL_E_X;
+#endif
+#else
+#ifdef PANEL_FLASH
+#ifdef PANEL_FLASH_OVERLAY
+    // lpm is one cycle slower than ld, testing the two overlay bits and merging the color takes about 6 more
+    return (uint32_t)(PANEL_CYCLES_PER_PIXEL + 7) * PANEL_E_X;
+#else
+#ifdef PANEL_FLASH_RLE
+    // lpm is one cycle slower than ld, telling a single pixel from a run takes about 4 more, runs are cheaper
+    return (uint32_t)(PANEL_CYCLES_PER_PIXEL + 5) * PANEL_E_X;
+#else
+    // lpm is one cycle slower than ld
+    return (uint32_t)(PANEL_CYCLES_PER_PIXEL + 1) * PANEL_E_X;
+#endif
+#endif
+#else
+#ifdef PANEL_PALETTE
+    // the palette lookup of every pixel
+    return (uint32_t)(PANEL_CYCLES_PER_PIXEL + 3) * PANEL_E_X;
+#else
+#ifdef PANEL_TEXT_MODE
+    // fetching the tile rows and picking the colors of every cell before the row is shifted, about 16 cycles per pixel
+    return (uint32_t)(PANEL_CYCLES_PER_PIXEL + 16) * PANEL_E_X;
+#else
+    return (uint32_t)PANEL_CYCLES_PER_PIXEL * PANEL_E_X;
+#endif
+#endif
+#endif
+#endif
+#endif
+}
+
+// the on and off delay of the 2 bit, flash and palette buffer in us, none for the 1 bit buffer and hub75e
+#if MAX_FRAMETIME > 0 && (defined(PANEL_BIG) || defined(PANEL_FLASH) || defined(PANEL_PALETTE)) && !defined(PANEL_HUB75E)
+#define PANEL_PASS_DELAY MAX_FRAMETIME
+#else
+#define PANEL_PASS_DELAY 0
+#endif
+
+// the delays after the passes from pass on, halved for every less significant bit
+constexpr uint32_t panelDelayCycles(uint8_t pass, uint8_t passes)
+{
+    return pass < passes ? 2 * (uint32_t)(PANEL_PASS_DELAY >> pass) * (PANEL_BOARD_CLOCK / 1000000UL) + panelDelayCycles(pass + 1, passes) : 0;
+}
+
+// the serial input after every row, when all PANEL_SERIAL_BYTES_PER_ROW bytes are there
+constexpr uint32_t panelSerialCycles()
+{
+#ifdef PANEL_SERIAL_INPUT
+    return 32 + 64 * (uint32_t)PANEL_SERIAL_BYTES_PER_ROW;
+#else
+    return 0;
+#endif
+}
+
+typedef struct PanelBudget
+{
+    // the whole panel object, buffer included
+    static constexpr uint32_t ram_bytes = sizeof(Panel);
+
+    // the image, in ram or in flash
+#ifdef PANEL_FLASH
+    static constexpr uint32_t buffer_bytes = PANEL_BUFFERSIZE;
+#else
+    static constexpr uint32_t buffer_bytes = sizeof(Panel::buffer);
+#endif
+
+    // every bit of color depth is shifted out once per row
+#if defined(PANEL_FLASH) || defined(PANEL_PALETTE)
+    static constexpr uint8_t passes = 4;
+#else
+#ifdef PANEL_BIG
+    static constexpr uint8_t passes = 2;
+#else
+    static constexpr uint8_t passes = 1;
+#endif
+#endif
+
+    static constexpr uint32_t cycles_per_row = passes * (panelPixelCycles() + PANEL_CYCLES_PER_ROW) + panelDelayCycles(0, passes) + panelSerialCycles();
+    static constexpr uint32_t cycles_per_frame = cycles_per_row * (PANEL_E_Y / 2);
+    static constexpr uint32_t refresh_rate = PANEL_BOARD_CLOCK / cycles_per_frame;
+} PanelBudget;
+
+static_assert(PanelBudget::ram_bytes + PANEL_RAM_RESERVE <= PANEL_BOARD_RAM,
+              "the panel buffer does not fit into the ram of this board, use a smaller size, the 1 bit buffer or the flash buffer (PANEL_RAM_RESERVE sets what is kept free)");
+
+#if !defined(PANEL_NO_BUFFER) && PANEL_MIN_REFRESH > 0
+static_assert(PanelBudget::refresh_rate >= PANEL_MIN_REFRESH,
+              "the estimated refresh rate is below PANEL_MIN_REFRESH, the panel would flicker, lower MAX_FRAMETIME, the size or the color depth");
+#endif
+
+#endif
+
+#endif // HUB75NANO_BUDGET_H
@@ -70,6 +70,8 @@
     HIGH_LAT; \
     CLEAR_LAT
 
-#define OVERFLOW (SREG & _BV(SREG_C))
+// for the compile time budget in boards/budget.h, atmega4809, OUTSET/OUTCLR are sts
+#define PANEL_BOARD_RAM 6144
+#define PANEL_CYCLES_PER_PIXEL 16
 
 #endif // HUB75NANO_EVERY_H
\ No newline at end of file
@@ -0,0 +1,448 @@
+#ifndef HUB75NANO_HOST_H
+#define HUB75NANO_HOST_H
+
+#include <stdio.h>
+#include "host_arduino.h"
+#include "../../Settings.h"
+
+// virtual pin numbers, they only have to be unique and below 32
+#ifndef RA
+#define RA 0 // row selector a
+#endif
+#ifndef RB
+#define RB 1 // row selector b
+#endif
+#ifndef RC
+#define RC 2 // row selector c
+#endif
+#ifndef RD
+#define RD 3 // row selector d
+#endif
+#ifndef RE
+#define RE 4 // row selector e
+#endif
+#ifndef RF
+#define RF 5 // red first byte
+#endif
+#ifndef GF
+#define GF 6 // green first byte
+#endif
+#ifndef BF
+#define BF 7 // blue first byte
+#endif
+#ifndef RS
+#define RS 8 // red second byte
+#endif
+#ifndef GS
+#define GS 9 // green second byte
+#endif
+#ifndef BS
+#define BS 10 // blue second byte
+#endif
+#ifndef CLK
+#define CLK 11 // clock signal
+#endif
+#ifndef LAT
+#define LAT 12 // data latch
+#endif
+#ifndef OE
+#define OE 13 // output enable
+#endif
+
+// the model counts time in ticks, every pin access costs one tick, like a single out on a 16MHz avr
+#ifndef PANEL_HOST_TICKS_PER_US
+#define PANEL_HOST_TICKS_PER_US 16
+#endif
+
+/*
+    software model of the panel behind the connector, fed by the pin macros of the host board.
+    it contains the column shift registers, their latches and the row drivers and adds up how long
+    every led was lit, so a frame can be turned back into an image after displayBuffer().
+    hub75: the led is lit while OE is low, on time is counted in ticks
+    hub75e: every GCLK (OE pulse) adds the greyscale word the chips have latched, data latch is 1 clock
+    with LAT high, anything longer is taken as the display latch (approximation of the stp1612pw05)
+*/
+class VirtualPanel
+{
+public:
+    // counters since the last beginFrame()
+    uint32_t clocks = 0;
+    uint32_t latches = 0;
+    uint32_t row_selects = 0;
+    uint32_t ticks = 0;
+
+    // drawing counters, only reset by resetDrawCounters(), the buffer setters report every call here
+    uint32_t pixel_calls = 0;
+    uint32_t span_calls = 0;
+    uint32_t span_pixels = 0;
+    uint32_t masked_calls = 0;
+    uint32_t masked_pixels = 0;
+    // optional, sees every buffer write before flipping, pixels is 1 for setBuffer and the clipped length for setSpan
+    // a setMasked call comes in as one call per run of set pixels
+    void (*draw_hook)(uint8_t x, uint8_t y, uint16_t pixels, uint32_t color) = nullptr;
+
+    void write(uint8_t pin, uint8_t level)
+    {
+        ticks++;
+        const uint32_t bit = (uint32_t)1 << pin;
+        const bool was_high = (pins & bit) != 0;
+        if (level)
+            pins |= bit;
+        else
+            pins &= ~bit;
+        if (was_high == (level != 0))
+            return;
+
+        if (pin == CLK)
+        {
+            if (level)
+                _clockEdge();
+        }
+        else if (pin == LAT)
+        {
+            if (level)
+                _latchRise();
+            else
+                _latchFall();
+        }
+        else if (pin == OE)
+        {
+            _outputEnableEdge(level);
+        }
+        else
+        {
+            _rowPinEdge(pin, level);
+        }
+    }
+
+    // all 6 color pins at once, like the bulk port write on the nano
+    void color(uint8_t value)
+    {
+        ticks++;
+        data = value & (uint8_t)63;
+    }
+
+    // all binary row address pins at once
+    void address(uint8_t row)
+    {
+        ticks++;
+        _selectRow(row & (uint8_t)(PANEL_E_Y / 2 - 1));
+    }
+
+    void wait(uint32_t us)
+    {
+        ticks += us * PANEL_HOST_TICKS_PER_US;
+    }
+
+    // clears the on times and counters, the latched data and row stay as they are
+    void beginFrame()
+    {
+        _accumulate();
+        memset(on_time, 0, sizeof(on_time));
+        clocks = 0;
+        latches = 0;
+        row_selects = 0;
+        frame_start = ticks;
+    }
+
+    void drawCall(uint8_t x, uint8_t y, uint16_t pixels, uint32_t color)
+    {
+        if (pixels == 1)
+        {
+            pixel_calls++;
+        }
+        else
+        {
+            span_calls++;
+            span_pixels += pixels;
+        }
+        if (draw_hook)
+            draw_hook(x, y, pixels, color);
+    }
+
+    // one setMasked call, bit i of mask is pixel x + i, already clipped
+    void maskedCall(uint8_t x, uint8_t y, uint16_t mask, uint32_t color)
+    {
+        masked_calls++;
+        masked_pixels += __builtin_popcount(mask);
+        if (!draw_hook)
+            return;
+        for (uint8_t i = 0; mask != 0;)
+        {
+            if (!(mask & 1))
+            {
+                mask >>= 1;
+                i++;
+                continue;
+            }
+            uint8_t end = i;
+            while (mask & 1)
+            {
+                mask >>= 1;
+                end++;
+            }
+            draw_hook(x + i, y, end - i, color);
+            i = end;
+        }
+    }
+
+    void resetDrawCounters()
+    {
+        pixel_calls = 0;
+        span_calls = 0;
+        span_pixels = 0;
+        masked_calls = 0;
+        masked_pixels = 0;
+    }
+
+    uint32_t frameTicks() const
+    {
+        return ticks - frame_start;
+    }
+
+    uint8_t row() const
+    {
+        return displayed_row;
+    }
+
+    // on time of one led since beginFrame(), in ticks (hub75) or greyscale clocks (hub75e), channel 0 red, 1 green, 2 blue
+    uint32_t onTime(uint8_t x, uint8_t y, uint8_t channel)
+    {
+        _accumulate();
+        return on_time[y][x][channel];
+    }
+
+    // turns the on times into 8 bit rgb, PANEL_E_X * PANEL_E_Y * 3 bytes, full_scale 0 takes the brightest led
+    void toRGB(uint8_t *rgb, uint32_t full_scale = 0)
+    {
+        _accumulate();
+        if (full_scale == 0)
+        {
+            for (uint8_t y = 0; y < PANEL_E_Y; y++)
+                for (uint8_t x = 0; x < PANEL_E_X; x++)
+                    for (uint8_t c = 0; c < 3; c++)
+                        full_scale = max(full_scale, on_time[y][x][c]);
+            if (full_scale == 0)
+                full_scale = 1;
+        }
+        for (uint8_t y = 0; y < PANEL_E_Y; y++)
+            for (uint8_t x = 0; x < PANEL_E_X; x++)
+                for (uint8_t c = 0; c < 3; c++)
+                    *rgb++ = (uint8_t)min((uint32_t)255, (uint32_t)(((uint64_t)on_time[y][x][c] * 255 + full_scale / 2) / full_scale));
+    }
+
+    // binary ppm (P6) of the reconstructed frame
+    bool writePPM(const char *path, uint32_t full_scale = 0)
+    {
+        static uint8_t rgb[PANEL_E_Y * PANEL_E_X * 3];
+        toRGB(rgb, full_scale);
+        FILE *file = fopen(path, "wb");
+        if (!file)
+            return false;
+        fprintf(file, "P6\n%d %d\n255\n", PANEL_E_X, PANEL_E_Y);
+        const bool written = fwrite(rgb, 1, sizeof(rgb), file) == sizeof(rgb);
+        fclose(file);
+        return written;
+    }
+
+private:
+    uint32_t pins = (uint32_t)1 << OE; // OE is active low, so the panel starts dark
+    uint8_t data = 0;
+    uint8_t shift_register[PANEL_E_X] = {};
+    uint8_t latched[PANEL_E_X] = {};
+    uint8_t displayed_row = 0;
+    uint8_t row_shift_position = 0xff;
+    uint32_t last_ticks = 0;
+    uint32_t frame_start = 0;
+    uint32_t on_time[PANEL_E_Y][PANEL_E_X][3] = {};
+#ifdef PANEL_HUB75E
+    uint8_t latch_clocks = 0;
+    uint16_t greyscale[PANEL_E_X][6] = {};
+    uint16_t shown[PANEL_E_X][6] = {};
+    uint8_t shown_row = 0xff;
+#endif
+
+    // the pins carry blue first on panels that need the color inversion
+    static uint8_t _channel(uint8_t bit)
+    {
+#ifdef PANEL_COLOR_INVERSION
+        return 2 - bit;
+#else
+        return bit;
+#endif
+    }
+
+    // adds the time since the last change to every lit led of the selected rows
+    void _accumulate()
+    {
+#ifndef PANEL_HUB75E
+        const uint32_t elapsed = ticks - last_ticks;
+        last_ticks = ticks;
+        if (elapsed == 0 || (pins & ((uint32_t)1 << OE)) || displayed_row >= PANEL_E_Y / 2)
+            return;
+        for (uint8_t x = 0; x < PANEL_E_X; x++)
+        {
+            for (uint8_t bit = 0; bit < 6; bit++)
+            {
+                if (latched[x] & (uint8_t)(1 << bit))
+                {
+                    on_time[displayed_row + (bit > 2 ? PANEL_E_Y / 2 : 0)][x][_channel(bit % 3)] += elapsed;
+                }
+            }
+        }
+#endif
+    }
+
+    // the first pixel shifted in ends up in column 0 after a full row
+    void _clockEdge()
+    {
+        clocks++;
+        memmove(shift_register, shift_register + 1, PANEL_E_X - 1);
+        shift_register[PANEL_E_X - 1] = data;
+#ifdef PANEL_HUB75E
+        if (pins & ((uint32_t)1 << LAT))
+            latch_clocks++;
+#endif
+    }
+
+    void _latchRise()
+    {
+#ifdef PANEL_HUB75E
+        latch_clocks = 0;
+#else
+        _accumulate();
+        latches++;
+        memcpy(latched, shift_register, PANEL_E_X);
+#endif
+    }
+
+    void _latchFall()
+    {
+#ifdef PANEL_HUB75E
+        latches++;
+        if (latch_clocks == 1)
+        {
+            // data latch, every latch adds one bit to the greyscale word
+            for (uint8_t x = 0; x < PANEL_E_X; x++)
+                for (uint8_t bit = 0; bit < 6; bit++)
+                    greyscale[x][bit] = (uint16_t)(greyscale[x][bit] << 1) | ((shift_register[x] >> bit) & (uint8_t)1);
+        }
+        else if (latch_clocks > 1)
+        {
+            // display latch, the greyscale words go to the pwm
+            memcpy(shown, greyscale, sizeof(shown));
+            memset(greyscale, 0, sizeof(greyscale));
+            shown_row = displayed_row;
+            memcpy(latched, shift_register, PANEL_E_X);
+        }
+#endif
+    }
+
+    void _outputEnableEdge(uint8_t level)
+    {
+#ifdef PANEL_HUB75E
+        // OE is the greyscale clock of the chips, they keep driving the row that was selected at the display latch
+        if (!level || shown_row >= PANEL_E_Y / 2)
+            return;
+        for (uint8_t x = 0; x < PANEL_E_X; x++)
+            for (uint8_t bit = 0; bit < 6; bit++)
+                on_time[shown_row + (bit > 2 ? PANEL_E_Y / 2 : 0)][x][_channel(bit % 3)] += shown[x][bit];
+#else
+        (void)level;
+        // account the time before the edge with the old OE level
+        const uint32_t bit = (uint32_t)1 << OE;
+        pins ^= bit;
+        _accumulate();
+        pins ^= bit;
+#endif
+    }
+
+    void _rowPinEdge(uint8_t pin, uint8_t level)
+    {
+#ifdef PANEL_3_PIN_ROWS
+        // A clocks the row shift registers, C is their serial input
+        if (pin == RA && level)
+        {
+            row_shift_position = (pins & ((uint32_t)1 << RC)) ? 0 : (uint8_t)(row_shift_position + 1);
+            _selectRow(row_shift_position);
+        }
+#else
+        (void)level;
+        if (pin == RA || pin == RB || pin == RC || pin == RD || pin == RE)
+        {
+            uint8_t row = 0;
+            row |= (pins >> RA) & 1;
+            row |= ((pins >> RB) & 1) << 1;
+            row |= ((pins >> RC) & 1) << 2;
+            row |= ((pins >> RD) & 1) << 3;
+            row |= ((pins >> RE) & 1) << 4;
+            _selectRow(row & (uint8_t)(PANEL_E_Y / 2 - 1));
+        }
+#endif
+    }
+
+    void _selectRow(uint8_t row)
+    {
+        _accumulate();
+        row_selects++;
+        displayed_row = row;
+    }
+};
+
+inline VirtualPanel virtual_panel;
+
+inline void delayMicroseconds(unsigned int us)
+{
+    virtual_panel.wait(us);
+}
+inline void delay(unsigned long ms)
+{
+    virtual_panel.wait(ms * 1000);
+}
+inline unsigned long micros()
+{
+    return virtual_panel.ticks / PANEL_HOST_TICKS_PER_US;
+}
+inline unsigned long millis()
+{
+    return micros() / 1000;
+}
+
+// helper definitions for setting/clearing
+#define high_pin(pin) virtual_panel.write(pin, 1)
+#define clear_pin(pin) virtual_panel.write(pin, 0)
+
+// the drawing functions report what they set, the counters and draw_hook of the simulated panel see every call
+#define PANEL_DRAW_HOOK(x, y, len, color) virtual_panel.drawCall(x, y, len, (color).color_444)
+#define PANEL_MASKED_HOOK(x, y, mask, color) virtual_panel.maskedCall(x, y, mask, (color).color_444)
+
+#define set_pin_output(pin) pinMode(pin, OUTPUT)
+
+#define HIGH_CLK high_pin(CLK)
+#define CLEAR_CLK clear_pin(CLK)
+#define HIGH_LAT high_pin(LAT)
+#define CLEAR_LAT clear_pin(LAT)
+#define HIGH_OE high_pin(OE)
+#define CLEAR_OE clear_pin(OE)
+#define Clock \
+    HIGH_CLK; \
+    CLEAR_CLK
+#define LATCH \
+    HIGH_LAT; \
+    CLEAR_LAT
+#define DCLK_GCLK \
+    HIGH_CLK;     \
+    HIGH_OE;      \
+    CLEAR_CLK;    \
+    CLEAR_OE
+#define LATCH_GCLK DCLK_GCLK
+
+// for the compile time budget in boards/budget.h, the model costs one tick per pin access, color and 2 clock edges per pixel
+#define PANEL_BOARD_RAM 0xffffffffUL
+#define PANEL_CYCLES_PER_PIXEL 3
+#define PANEL_BOARD_CLOCK (PANEL_HOST_TICKS_PER_US * 1000000UL)
+
+// the serial port, fed from a byte stream on the virtual time
+#include "host_serial.h"
+
+#endif // HUB75NANO_HOST_H
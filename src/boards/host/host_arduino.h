@@ -0,0 +1,37 @@
+#ifndef HUB75NANO_HOST_ARDUINO_H
+#define HUB75NANO_HOST_ARDUINO_H
+
+// the small part of the arduino api the library uses, so it can be compiled for a pc
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define OUTPUT 1
+#define INPUT 0
+
+// flash is just normal memory on the host
+#define PROGMEM
+#define PGM_P const char *
+#define PGM_VOID_P const void *
+#define pgm_read_byte(address) (*(const uint8_t *)(address))
+#define pgm_read_word(address) (*(const uint16_t *)(address))
+#define pgm_read_dword(address) (*(const uint32_t *)(address))
+#define pgm_read_ptr(address) (*(const void *const *)(address))
+#define memcpy_P memcpy
+
+template <typename T>
+constexpr T min(T a, T b) { return a < b ? a : b; }
+template <typename T>
+constexpr T max(T a, T b) { return a > b ? a : b; }
+
+inline void pinMode(uint8_t, uint8_t) {}
+
+// timing runs on the virtual time of the simulated panel, defined in host.h
+inline void delayMicroseconds(unsigned int us);
+inline void delay(unsigned long ms);
+inline unsigned long micros();
+inline unsigned long millis();
+
+#endif // HUB75NANO_HOST_ARDUINO_H
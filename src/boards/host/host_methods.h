@@ -0,0 +1,48 @@
+#ifndef HUB75NANO_HOST_METHODS_H
+#define HUB75NANO_HOST_METHODS_H
+
+#include "host.h"
+#include "../method_helper.h"
+#include "../../Settings.h"
+
+// bulk pin access color, the model takes all 6 bits at once
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+_set_color(uint8_t value)
+{
+    virtual_panel.color(value);
+}
+
+#ifndef PANEL_ROW_VAR
+uint8_t _row = 0;
+#define PANEL_ROW_VAR _row
+#endif
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+_stepRow()
+{
+#ifdef PANEL_3_PIN_ROWS
+    if (PANEL_ROW_VAR == 0)
+    {
+        high_pin(RC);
+        high_pin(RA);
+        clear_pin(RA);
+        clear_pin(RC);
+    }
+    else
+    {
+        high_pin(RA);
+        clear_pin(RA);
+    }
+#else
+    virtual_panel.address(PANEL_ROW_VAR);
+#endif
+    PANEL_ADVANCE_ROW;
+}
+
+#endif // HUB75NANO_HOST_METHODS_H
@@ -0,0 +1,154 @@
+#ifndef HUB75NANO_HOST_SERIAL_H
+#define HUB75NANO_HOST_SERIAL_H
+
+#include "host.h"
+
+// the receive buffer of the avr core, one byte of it always stays free
+#ifndef PANEL_HOST_SERIAL_BUFFER
+#define PANEL_HOST_SERIAL_BUFFER 64
+#endif
+// available() and read() on a 16MHz avr, in ticks
+#ifndef PANEL_HOST_SERIAL_AVAILABLE_TICKS
+#define PANEL_HOST_SERIAL_AVAILABLE_TICKS 16
+#endif
+#ifndef PANEL_HOST_SERIAL_READ_TICKS
+#define PANEL_HOST_SERIAL_READ_TICKS 32
+#endif
+
+/*
+    stand-in for the hardware serial port, the pc side is the byte stream given to send().
+    the bytes arrive on the virtual time of the panel at the baud rate of begin() (10 bits per byte) and go into a
+    receive buffer like the one of the avr core, bytes that arrive while it is full are lost and counted.
+    with a window the pc side keeps at most that many bytes unacknowledged, every byte the sketch write()s
+    acknowledges credit more, like a sender waiting for PANEL_SERIAL_ACK
+*/
+class HostSerial
+{
+public:
+    // counters since the last send()
+    uint32_t received = 0;      // bytes that made it into the receive buffer
+    uint32_t dropped = 0;       // bytes that arrived while it was full
+    uint32_t written = 0;       // bytes the sketch wrote back
+    uint32_t stalled_ticks = 0; // time the pc side waited for acknowledgements
+
+    void begin(unsigned long baud_rate)
+    {
+        baud = baud_rate;
+    }
+
+    void send(const uint8_t *data, size_t length, size_t window_bytes = 0, size_t credit_bytes = 0)
+    {
+        stream = data;
+        stream_length = length;
+        sent = 0;
+        acknowledged = 0;
+        window = window_bytes;
+        credit = credit_bytes;
+        received = 0;
+        dropped = 0;
+        written = 0;
+        stalled_ticks = 0;
+        wire = (uint64_t)virtual_panel.ticks * baud;
+    }
+
+    // the whole stream left the pc side
+    bool sent_all()
+    {
+        _arrive();
+        return sent == stream_length;
+    }
+
+    int available()
+    {
+        virtual_panel.ticks += PANEL_HOST_SERIAL_AVAILABLE_TICKS;
+        _arrive();
+        return fill;
+    }
+
+    int read()
+    {
+        virtual_panel.ticks += PANEL_HOST_SERIAL_READ_TICKS;
+        _arrive();
+        if (fill == 0)
+        {
+            return -1;
+        }
+        const uint8_t value = rx[tail];
+        tail = (tail + 1) % PANEL_HOST_SERIAL_BUFFER;
+        fill--;
+        return value;
+    }
+
+    // the byte itself is not kept, every write is one acknowledgement for the pc side
+    size_t write(uint8_t)
+    {
+        _arrive();
+        written++;
+        if (credit == 0)
+        {
+            return 1;
+        }
+        const bool was_blocked = _blocked();
+        acknowledged += credit;
+        // the wire stood still while the pc side waited
+        const uint64_t now = (uint64_t)virtual_panel.ticks * baud;
+        if (was_blocked && wire < now)
+        {
+            stalled_ticks += (uint32_t)((now - wire) / baud);
+            wire = now;
+        }
+        return 1;
+    }
+
+private:
+    unsigned long baud = 115200;
+    const uint8_t *stream = nullptr;
+    size_t stream_length = 0;
+    size_t sent = 0;
+    size_t acknowledged = 0;
+    size_t window = 0;
+    size_t credit = 0;
+    // when the wire is free for the next byte, in ticks times baud so no rounding adds up
+    uint64_t wire = 0;
+    uint8_t rx[PANEL_HOST_SERIAL_BUFFER] = {};
+    uint8_t head = 0;
+    uint8_t tail = 0;
+    uint8_t fill = 0;
+
+    bool _blocked() const
+    {
+        return window != 0 && sent >= acknowledged + window;
+    }
+
+    // moves every byte that finished on the wire by now into the receive buffer
+    void _arrive()
+    {
+        const uint64_t now = (uint64_t)virtual_panel.ticks * baud;
+        const uint64_t byte_time = 10ULL * PANEL_HOST_TICKS_PER_US * 1000000ULL;
+        while (sent < stream_length && !_blocked() && wire + byte_time <= now)
+        {
+            wire += byte_time;
+            if (fill < PANEL_HOST_SERIAL_BUFFER - 1)
+            {
+                rx[head] = stream[sent];
+                head = (head + 1) % PANEL_HOST_SERIAL_BUFFER;
+                fill++;
+                received++;
+            }
+            else
+            {
+                dropped++;
+            }
+            sent++;
+        }
+        // an idle wire does not save up time for later bytes
+        if (sent == stream_length && wire < now)
+        {
+            wire = now;
+        }
+    }
+};
+
+inline HostSerial Serial;
+
+#endif // HUB75NANO_HOST_SERIAL_H
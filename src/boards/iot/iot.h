@@ -103,7 +103,8 @@ OE      PA10    12
     CLEAR_LAT;            \
     delayMicroseconds(2)
 
-// todo, no idea how
-#define OVERFLOW 0
+// for the compile time budget in boards/budget.h, samd21 at 48MHz, single cycle io bus
+#define PANEL_BOARD_RAM 32768
+#define PANEL_CYCLES_PER_PIXEL 12
 
 #endif // HUB75NANO_IOT_H
\ No newline at end of file
@@ -70,6 +70,15 @@
     HIGH_LAT; \
     CLEAR_LAT
 
-#define OVERFLOW (SREG & _BV(SREG_C))
+// registers for the hand scheduled row shifter, only usable with the default color and clock pins
+#if RF == 47 and GF == 46 and BF == 45 and RS == 44 and GS == 43 and BS == 42 and CLK == 37
+#define PANEL_ASM_COLOR_PORT PORTL /*not in the io space, needs sts and the colors shifted by 2*/
+#define PANEL_ASM_CLK_TOGGLE PINC /*writing a 1 to PINx toggles the pin in a single cycle*/
+#define PANEL_ASM_CLK_BIT 0
+#endif
+
+// for the compile time budget in boards/budget.h, atmega2560, the colors need sts
+#define PANEL_BOARD_RAM 8192
+#define PANEL_CYCLES_PER_PIXEL 14
 
 #endif // HUB75NANO_MEGA_H
\ No newline at end of file
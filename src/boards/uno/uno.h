@@ -96,6 +96,15 @@
     /*turn off clk and oe at the same time, with no regards to other values*/
 #endif
 
-#define OVERFLOW (SREG & _BV(SREG_C))
+// registers for the hand scheduled row shifter, only usable with the default color and clock pins
+#if RF == 14 and GF == 15 and BF == 16 and RS == 17 and GS == 18 and BS == 19 and CLK == 9
+#define PANEL_ASM_COLOR_PORT PORTC
+#define PANEL_ASM_CLK_TOGGLE PINB /*writing a 1 to PINx toggles the pin in a single cycle*/
+#define PANEL_ASM_CLK_BIT 1
+#endif
+
+// for the compile time budget in boards/budget.h, atmega328p, sbi/cbi clock and a bulk port write for the colors
+#define PANEL_BOARD_RAM 2048
+#define PANEL_CYCLES_PER_PIXEL 12
 
 #endif // HUB75NANO_UNO_H
\ No newline at end of file
@@ -61,4 +61,11 @@
 #define Clock() do { HIGH_CLK; __asm__ __volatile__("nop;"); CLEAR_CLK; __asm__ __volatile__("nop;"); } while(0)
 #define Latch() do { HIGH_LAT; __asm__ __volatile__("nop;"); CLEAR_LAT; __asm__ __volatile__("nop;"); } while(0)
 
+// for the compile time budget in boards/budget.h, ra4m1 at 48MHz, the port registers sit behind the peripheral bus
+#define PANEL_BOARD_RAM 32768
+#define PANEL_CYCLES_PER_PIXEL 20
+#ifndef PANEL_BOARD_CLOCK
+#define PANEL_BOARD_CLOCK 48000000UL
+#endif
+
 #endif // HUB75NANO_UNO_R4_H
@@ -6,10 +6,41 @@
 
 #include "buffer_common.h"
 
+// {byte offset, 1 << shift, mask, mask of the next byte} of every pixel, indexed by (lower half << 2) | (x & 3)
+// pixel p of the upper half starts at bit p * 6, the lower half 3 bits later
+inline const uint8_t *_pixelSlot(uint8_t slot)
+{
+    static const uint8_t slots[8][4] PROGMEM = {
+        {0, 1 << 0, 0b00000111, 0b00000000}, // upper, first pixel
+        {0, 1 << 6, 0b11000000, 0b00000001}, // upper, second pixel
+        {1, 1 << 4, 0b01110000, 0b00000000}, // upper, third pixel
+        {2, 1 << 2, 0b00011100, 0b00000000}, // upper, fourth pixel
+        {0, 1 << 3, 0b00111000, 0b00000000}, // lower, first pixel
+        {1, 1 << 1, 0b00001110, 0b00000000}, // lower, second pixel
+        {1, 1 << 7, 0b10000000, 0b00000011}, // lower, third pixel
+        {2, 1 << 5, 0b11100000, 0b00000000}, // lower, fourth pixel
+    };
+    return slots[slot];
+}
+
+// the bits of one pixel for _writeSlot
+inline uint16_t _pixelBits(Color color)
+{
+    return _channelBits(color, 0);
+}
+
+// the color at all 8 pixel positions of a LED_short (4 pixels of both halves), for whole blocks
+inline void _expandColor(Color color, uint8_t *pattern)
+{
+    const uint8_t rgb = _channelBits(color, 0);
+    const uint8_t pixel = rgb | (rgb << 3);
+    _spreadGroup(pixel | ((uint16_t)pixel << 6), pattern);
+}
+
 void _setSmallBuffer(uint8_t x, uint8_t y, Color color)
 {
     // dont bother if outside of the panel
-    if (x >= PANEL_X || y >= PANEL_Y)
+    if (_offCanvas(x) || y >= PANEL_Y)
     {
         return;
     }
@@ -18,175 +49,17 @@ void _setSmallBuffer(uint8_t x, uint8_t y, Color color)
     y = PANEL_Y - y - 1;
 #endif
 #ifdef PANEL_FLIP_HORIZONTAL
-    x = PANEL_X - x - 1;
+    x = PANEL_CANVAS_X - x - 1;
 #endif
-    if (y < (PANEL_Y / 2))
+    uint8_t half = 0;
+    if (y >= (PANEL_Y / 2))
     {
-        // we are in upper half of pixels
-        uint16_t index = ((y * PANEL_X) + x) / 4;
-        switch (x & 3)
-        {
-        case 0: /*first pixel*/
-            buffer[index].redUpperBit1Led1 = color.red;
-            buffer[index].greenUpperBit1Led1 = color.green;
-            buffer[index].blueUpperBit1Led1 = color.blue;
-            break;
-        case 1: /*second pixel*/
-            buffer[index].redUpperBit1Led2 = color.red;
-            buffer[index].greenUpperBit1Led2 = color.green;
-            buffer[index].blueUpperBit1Led2 = color.blue;
-            break;
-        case 2: /*third pixel*/
-            buffer[index].redUpperBit1Led3 = color.red;
-            buffer[index].greenUpperBit1Led3 = color.green;
-            buffer[index].blueUpperBit1Led3 = color.blue;
-            break;
-        case 3: /*fourth pixel*/
-            buffer[index].redUpperBit1Led4 = color.red;
-            buffer[index].greenUpperBit1Led4 = color.green;
-            buffer[index].blueUpperBit1Led4 = color.blue;
-            break;
-        default:
-            break;
-        }
-    }
-    else
-    {
-        y -= (PANEL_Y / 2);
         // we are in lower half of pixels
-        uint16_t index = (y * PANEL_X + x) / 4;
-        switch (x & 3)
-        {
-        case 0: /*first pixel*/
-            buffer[index].redLowerBit1Led1 = color.red;
-            buffer[index].greenLowerBit1Led1 = color.green;
-            buffer[index].blueLowerBit1Led1 = color.blue;
-            break;
-        case 1: /*second pixel*/
-            buffer[index].redLowerBit1Led2 = color.red;
-            buffer[index].greenLowerBit1Led2 = color.green;
-            buffer[index].blueLowerBit1Led2 = color.blue;
-            break;
-        case 2: /*third pixel*/
-            buffer[index].redLowerBit1Led3 = color.red;
-            buffer[index].greenLowerBit1Led3 = color.green;
-            buffer[index].blueLowerBit1Led3 = color.blue;
-            break;
-        case 3: /*fourth pixel*/
-            buffer[index].redLowerBit1Led4 = color.red;
-            buffer[index].greenLowerBit1Led4 = color.green;
-            buffer[index].blueLowerBit1Led4 = color.blue;
-            break;
-        default:
-            break;
-        }
-    }
-}
-
-void _setSmallBuffer4x(uint8_t x, uint8_t y, uint8_t block_count, Color color)
-{
-#ifdef PANEL_FLIP_VERTICAL
-    y = PANEL_Y - y - 1;
-#endif
-#ifdef PANEL_FLIP_HORIZONTAL
-    x = PANEL_X - x - 1;
-#endif
-    if (y < (PANEL_Y / 2))
-    {
-        // we are in upper half of pixels
-        uint16_t index = ((y * PANEL_X) + x) / 4;
-
-        buffer[index].redUpperBit1Led1 = color.red;
-        buffer[index].greenUpperBit1Led1 = color.green;
-        buffer[index].blueUpperBit1Led1 = color.blue;
-        buffer[index].redUpperBit1Led2 = color.red;
-        buffer[index].greenUpperBit1Led2 = color.green;
-        buffer[index].blueUpperBit1Led2 = color.blue;
-        buffer[index].redUpperBit1Led3 = color.red;
-        buffer[index].greenUpperBit1Led3 = color.green;
-        buffer[index].blueUpperBit1Led3 = color.blue;
-        buffer[index].redUpperBit1Led4 = color.red;
-        buffer[index].greenUpperBit1Led4 = color.green;
-        buffer[index].blueUpperBit1Led4 = color.blue;
-
-        // temp buffers to store the cleaned values
-        uint8_t lower, mid, higher;
-        uint8_t *start = (uint8_t *)&buffer[index];
-
-        // clean and cache the bits needed for thsi half
-        lower = ((*start) & LED_SHORT_MASK_UPPER_1);
-        start++;
-        mid = ((*start) & LED_SHORT_MASK_UPPER_2);
-        start++;
-        higher = ((*start) & LED_SHORT_MASK_UPPER_3);
-        start++;
-
-#ifdef PANEL_FLIP_HORIZONTAL
-        start -= block_count * 3;
-#endif
-
-        for (uint8_t i = 1; i < block_count; i++)
-        {
-            // apply the masks so we only copy the one half of the pixels we are "allowed" to
-            *start &= LED_SHORT_MASK_LOWER_1;
-            *start |= lower;
-            start++;
-            *start &= LED_SHORT_MASK_LOWER_2;
-            *start |= mid;
-            start++;
-            *start &= LED_SHORT_MASK_LOWER_3;
-            *start |= higher;
-            start++;
-        }
-    }
-    else
-    {
         y -= (PANEL_Y / 2);
-        // we are in lower half of pixels
-        uint16_t index = ((y * PANEL_X) + x) / 4;
-
-        buffer[index].redLowerBit1Led1 = color.red;
-        buffer[index].greenLowerBit1Led1 = color.green;
-        buffer[index].blueLowerBit1Led1 = color.blue;
-        buffer[index].redLowerBit1Led2 = color.red;
-        buffer[index].greenLowerBit1Led2 = color.green;
-        buffer[index].blueLowerBit1Led2 = color.blue;
-        buffer[index].redLowerBit1Led3 = color.red;
-        buffer[index].greenLowerBit1Led3 = color.green;
-        buffer[index].blueLowerBit1Led3 = color.blue;
-        buffer[index].redLowerBit1Led4 = color.red;
-        buffer[index].greenLowerBit1Led4 = color.green;
-        buffer[index].blueLowerBit1Led4 = color.blue;
-
-        // temp buffers to store the cleaned values
-        uint8_t lower, mid, higher;
-        uint8_t *start = (uint8_t *)&buffer[index];
-
-        // clean and cache the bits needed for thsi half
-        lower = ((*start) & LED_SHORT_MASK_LOWER_1);
-        start++;
-        mid = ((*start) & LED_SHORT_MASK_LOWER_2);
-        start++;
-        higher = ((*start) & LED_SHORT_MASK_LOWER_3);
-        start++;
-
-#ifdef PANEL_FLIP_HORIZONTAL
-        start -= block_count * 3;
-#endif
-        for (uint8_t i = 1; i < block_count; i++)
-        {
-            // apply the masks so we only copy the one half of the pixels we are "allowed" to
-            *start &= LED_SHORT_MASK_UPPER_1;
-            *start |= lower;
-            start++;
-            *start &= LED_SHORT_MASK_UPPER_2;
-            *start |= mid;
-            start++;
-            *start &= LED_SHORT_MASK_UPPER_3;
-            *start |= higher;
-            start++;
-        }
+        half = 4;
     }
+    uint16_t index = ((uint16_t)_bufferRow(y) * PANEL_CANVAS_X + x) / 4;
+    _writeSlot((uint8_t *)&PANEL_SHOWN_BUFFER[index], _pixelSlot(half | (x & 3)), _pixelBits(color));
 }
 
 #endif
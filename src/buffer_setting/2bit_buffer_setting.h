@@ -6,10 +6,44 @@
 #include "buffer_common.h"
 #include "../Settings.h"
 
+// {byte offset, 1 << shift, mask, mask of the next byte} of every pixel, indexed by (lower half << 2) | (x & 3)
+// pixel p of the upper half starts at bit p * 12 with the second bit 6 bits further up, the lower half 3 bits later
+inline const uint8_t *_pixelSlot(uint8_t slot)
+{
+    static const uint8_t slots[8][4] PROGMEM = {
+        {0, 1 << 0, 0b11000111, 0b00000001}, // upper, first pixel
+        {1, 1 << 4, 0b01110000, 0b00011100}, // upper, second pixel
+        {3, 1 << 0, 0b11000111, 0b00000001}, // upper, third pixel
+        {4, 1 << 4, 0b01110000, 0b00011100}, // upper, fourth pixel
+        {0, 1 << 3, 0b00111000, 0b00001110}, // lower, first pixel
+        {1, 1 << 7, 0b10000000, 0b11100011}, // lower, second pixel
+        {3, 1 << 3, 0b00111000, 0b00001110}, // lower, third pixel
+        {4, 1 << 7, 0b10000000, 0b11100011}, // lower, fourth pixel
+    };
+    return slots[slot];
+}
+
+// the bits of one pixel for _writeSlot, the second bit sits 6 bits above the first one
+inline uint16_t _pixelBits(Color color)
+{
+    return _channelBits(color, 0) | ((uint16_t)_channelBits(color, 1) << 6);
+}
+
+// the color at all 8 pixel positions of a LED_long, both bits of depth, for whole blocks
+inline void _expandColor(Color color, uint8_t *pattern)
+{
+    const uint8_t bit_1 = _channelBits(color, 0);
+    const uint8_t bit_2 = _channelBits(color, 1);
+    _spreadGroup(bit_1 | (bit_1 << 3) | ((uint16_t)(bit_2 | (bit_2 << 3)) << 6), pattern);
+    pattern[3] = pattern[0];
+    pattern[4] = pattern[1];
+    pattern[5] = pattern[2];
+}
+
 void _setBigBuffer(uint8_t x, uint8_t y, Color color)
 {
     // dont bother if outside of the panel
-    if (x >= PANEL_X || y >= PANEL_Y)
+    if (_offCanvas(x) || y >= PANEL_Y)
     {
         return;
     }
@@ -18,256 +52,17 @@ void _setBigBuffer(uint8_t x, uint8_t y, Color color)
     y = PANEL_Y - y - 1;
 #endif
 #ifdef PANEL_FLIP_HORIZONTAL
-    x = PANEL_X - x - 1;
+    x = PANEL_CANVAS_X - x - 1;
 #endif
-    if (y < (PANEL_Y / 2))
-    {
-        // we are in upper half of pixels
-        uint8_t index = (y * PANEL_X + x) / 4;
-        switch (x & 3)
-        {
-        case 0: /*first pixel*/
-            buffer[index].redUpperBit1Led1 = color.red;
-            buffer[index].greenUpperBit1Led1 = color.green;
-            buffer[index].blueUpperBit1Led1 = color.blue;
-            buffer[index].redUpperBit2Led1 = color.red >> (uint8_t)1;
-            buffer[index].greenUpperBit2Led1 = color.green >> (uint8_t)1;
-            buffer[index].blueUpperBit2Led1 = color.blue >> (uint8_t)1;
-            break;
-        case 1: /*second pixel*/
-            buffer[index].redUpperBit1Led2 = color.red;
-            buffer[index].greenUpperBit1Led2 = color.green;
-            buffer[index].blueUpperBit1Led2 = color.blue;
-            buffer[index].redUpperBit2Led2 = color.red >> (uint8_t)1;
-            buffer[index].greenUpperBit2Led2 = color.green >> (uint8_t)1;
-            buffer[index].blueUpperBit2Led2 = color.blue >> (uint8_t)1;
-            break;
-        case 2: /*third pixel*/
-            buffer[index].redUpperBit1Led3 = color.red;
-            buffer[index].greenUpperBit1Led3 = color.green;
-            buffer[index].blueUpperBit1Led3 = color.blue;
-            buffer[index].redUpperBit2Led3 = color.red >> (uint8_t)1;
-            buffer[index].greenUpperBit2Led3 = color.green >> (uint8_t)1;
-            buffer[index].blueUpperBit2Led3 = color.blue >> (uint8_t)1;
-            break;
-        case 3: /*fourth pixel*/
-            buffer[index].redUpperBit1Led4 = color.red;
-            buffer[index].greenUpperBit1Led4 = color.green;
-            buffer[index].blueUpperBit1Led4 = color.blue;
-            buffer[index].redUpperBit2Led4 = color.red >> (uint8_t)1;
-            buffer[index].greenUpperBit2Led4 = color.green >> (uint8_t)1;
-            buffer[index].blueUpperBit2Led4 = color.blue >> (uint8_t)1;
-            break;
-        default:
-            break;
-        }
-    }
-    else
+    uint8_t half = 0;
+    if (y >= (PANEL_Y / 2))
     {
-        y -= (PANEL_Y / 2);
         // we are in lower half of pixels
-        uint8_t index = (y * PANEL_X + x) / 4;
-        switch (x & 3)
-        {
-        case 0:
-            buffer[index].redLowerBit1Led1 = color.red;
-            buffer[index].greenLowerBit1Led1 = color.green;
-            buffer[index].blueLowerBit1Led1 = color.blue;
-            buffer[index].redLowerBit2Led1 = color.red >> (uint8_t)1;
-            buffer[index].greenLowerBit2Led1 = color.green >> (uint8_t)1;
-            buffer[index].blueLowerBit2Led1 = color.blue >> (uint8_t)1;
-            break;
-        case 1: /*second pixel*/
-            buffer[index].redLowerBit1Led2 = color.red;
-            buffer[index].greenLowerBit1Led2 = color.green;
-            buffer[index].blueLowerBit1Led2 = color.blue;
-            buffer[index].redLowerBit2Led2 = color.red >> (uint8_t)1;
-            buffer[index].greenLowerBit2Led2 = color.green >> (uint8_t)1;
-            buffer[index].blueLowerBit2Led2 = color.blue >> (uint8_t)1;
-            break;
-        case 2: /*third pixel*/
-            buffer[index].redLowerBit1Led3 = color.red;
-            buffer[index].greenLowerBit1Led3 = color.green;
-            buffer[index].blueLowerBit1Led3 = color.blue;
-            buffer[index].redLowerBit2Led3 = color.red >> (uint8_t)1;
-            buffer[index].greenLowerBit2Led3 = color.green >> (uint8_t)1;
-            buffer[index].blueLowerBit2Led3 = color.blue >> (uint8_t)1;
-            break;
-        case 3: /*fourth pixel*/
-            buffer[index].redLowerBit1Led4 = color.red;
-            buffer[index].greenLowerBit1Led4 = color.green;
-            buffer[index].blueLowerBit1Led4 = color.blue;
-            buffer[index].redLowerBit2Led4 = color.red >> (uint8_t)1;
-            buffer[index].greenLowerBit2Led4 = color.green >> (uint8_t)1;
-            buffer[index].blueLowerBit2Led4 = color.blue >> (uint8_t)1;
-            break;
-        default:
-            break;
-        }
-    }
-}
-
-void _setBigBuffer4x(uint8_t x, uint8_t y, uint8_t block_count, Color color)
-{
-#ifdef PANEL_FLIP_VERTICAL
-    y = PANEL_Y - y - 1;
-#endif
-#ifdef PANEL_FLIP_HORIZONTAL
-    x = PANEL_X - x - 1;
-#endif
-    if (y < (PANEL_Y / 2))
-    {
-        // we are in upper half of pixels
-        uint16_t index = ((y * PANEL_X) + x) / 4;
-
-        buffer[index].redUpperBit1Led1 = color.red;
-        buffer[index].greenUpperBit1Led1 = color.green;
-        buffer[index].blueUpperBit1Led1 = color.blue;
-        buffer[index].redUpperBit1Led2 = color.red;
-        buffer[index].greenUpperBit1Led2 = color.green;
-        buffer[index].blueUpperBit1Led2 = color.blue;
-        buffer[index].redUpperBit1Led3 = color.red;
-        buffer[index].greenUpperBit1Led3 = color.green;
-        buffer[index].blueUpperBit1Led3 = color.blue;
-        buffer[index].redUpperBit1Led4 = color.red;
-        buffer[index].greenUpperBit1Led4 = color.green;
-        buffer[index].blueUpperBit1Led4 = color.blue;
-        // second bit
-        buffer[index].redUpperBit2Led1 = color.red >> (uint8_t)1;
-        buffer[index].greenUpperBit2Led1 = color.green >> (uint8_t)1;
-        buffer[index].blueUpperBit2Led1 = color.blue >> (uint8_t)1;
-        buffer[index].redUpperBit2Led2 = color.red >> (uint8_t)1;
-        buffer[index].greenUpperBit2Led2 = color.green >> (uint8_t)1;
-        buffer[index].blueUpperBit2Led2 = color.blue >> (uint8_t)1;
-        buffer[index].redUpperBit2Led3 = color.red >> (uint8_t)1;
-        buffer[index].greenUpperBit2Led3 = color.green >> (uint8_t)1;
-        buffer[index].blueUpperBit2Led3 = color.blue >> (uint8_t)1;
-        buffer[index].redUpperBit2Led4 = color.red >> (uint8_t)1;
-        buffer[index].greenUpperBit2Led4 = color.green >> (uint8_t)1;
-        buffer[index].blueUpperBit2Led4 = color.blue >> (uint8_t)1;
-
-        // temp buffers to store the cleaned values
-        uint8_t lowest, lower, lowmid, mid, higher, highest;
-        uint8_t *start = (uint8_t *)&buffer[index];
-
-        // clean and cache the bits needed for thsi half
-        lowest = ((*start) & LED_LONG_MASK_UPPER_1);
-        start++;
-        lower = ((*start) & LED_LONG_MASK_UPPER_2);
-        start++;
-        lowmid = ((*start) & LED_LONG_MASK_UPPER_3);
-        start++;
-        mid = ((*start) & LED_LONG_MASK_UPPER_4);
-        start++;
-        higher = ((*start) & LED_LONG_MASK_UPPER_5);
-        start++;
-        highest = ((*start) & LED_LONG_MASK_UPPER_6);
-        start++;
-
-#ifdef PANEL_FLIP_HORIZONTAL
-        start -= block_count * 6;
-#endif
-
-        for (uint8_t i = 1; i < block_count; i++)
-        {
-            // apply the masks so we only copy the one half of the pixels we are "allowed" to
-            *start &= LED_LONG_MASK_LOWER_1;
-            *start |= lowest;
-            start++;
-            *start &= LED_LONG_MASK_LOWER_2;
-            *start |= lower;
-            start++;
-            *start &= LED_LONG_MASK_LOWER_3;
-            *start |= lowmid;
-            start++;
-            *start &= LED_LONG_MASK_LOWER_4;
-            *start |= mid;
-            start++;
-            *start &= LED_LONG_MASK_LOWER_5;
-            *start |= higher;
-            start++;
-            *start &= LED_LONG_MASK_LOWER_6;
-            *start |= highest;
-            start++;
-        }
-    }
-    else
-    {
         y -= (PANEL_Y / 2);
-        // we are in lower half of pixels
-        uint16_t index = ((y * PANEL_X) + x) / 4;
-
-        buffer[index].redLowerBit1Led1 = color.red;
-        buffer[index].greenLowerBit1Led1 = color.green;
-        buffer[index].blueLowerBit1Led1 = color.blue;
-        buffer[index].redLowerBit1Led2 = color.red;
-        buffer[index].greenLowerBit1Led2 = color.green;
-        buffer[index].blueLowerBit1Led2 = color.blue;
-        buffer[index].redLowerBit1Led3 = color.red;
-        buffer[index].greenLowerBit1Led3 = color.green;
-        buffer[index].blueLowerBit1Led3 = color.blue;
-        buffer[index].redLowerBit1Led4 = color.red;
-        buffer[index].greenLowerBit1Led4 = color.green;
-        buffer[index].blueLowerBit1Led4 = color.blue;
-        // second bit
-        buffer[index].redLowerBit2Led1 = color.red >> (uint8_t)1;
-        buffer[index].greenLowerBit2Led1 = color.green >> (uint8_t)1;
-        buffer[index].blueLowerBit2Led1 = color.blue >> (uint8_t)1;
-        buffer[index].redLowerBit2Led2 = color.red >> (uint8_t)1;
-        buffer[index].greenLowerBit2Led2 = color.green >> (uint8_t)1;
-        buffer[index].blueLowerBit2Led2 = color.blue >> (uint8_t)1;
-        buffer[index].redLowerBit2Led3 = color.red >> (uint8_t)1;
-        buffer[index].greenLowerBit2Led3 = color.green >> (uint8_t)1;
-        buffer[index].blueLowerBit2Led3 = color.blue >> (uint8_t)1;
-        buffer[index].redLowerBit2Led4 = color.red >> (uint8_t)1;
-        buffer[index].greenLowerBit2Led4 = color.green >> (uint8_t)1;
-        buffer[index].blueLowerBit2Led4 = color.blue >> (uint8_t)1;
-
-        // temp buffers to store the cleaned values
-        uint8_t lowest, lower, lowmid, mid, higher, highest;
-        uint8_t *start = (uint8_t *)&buffer[index];
-
-        // clean and cache the bits needed for thsi half
-        lowest = ((*start) & LED_LONG_MASK_LOWER_1);
-        start++;
-        lower = ((*start) & LED_LONG_MASK_LOWER_2);
-        start++;
-        lowmid = ((*start) & LED_LONG_MASK_LOWER_3);
-        start++;
-        mid = ((*start) & LED_LONG_MASK_LOWER_4);
-        start++;
-        higher = ((*start) & LED_LONG_MASK_LOWER_5);
-        start++;
-        highest = ((*start) & LED_LONG_MASK_LOWER_6);
-        start++;
-
-#ifdef PANEL_FLIP_HORIZONTAL
-        start -= block_count * 6;
-#endif
-
-        for (uint8_t i = 1; i < block_count; i++)
-        {
-            // apply the masks so we only copy the one half of the pixels we are "allowed" to
-            *start &= LED_LONG_MASK_UPPER_1;
-            *start |= lowest;
-            start++;
-            *start &= LED_LONG_MASK_UPPER_2;
-            *start |= lower;
-            start++;
-            *start &= LED_LONG_MASK_UPPER_3;
-            *start |= lowmid;
-            start++;
-            *start &= LED_LONG_MASK_UPPER_4;
-            *start |= mid;
-            start++;
-            *start &= LED_LONG_MASK_UPPER_5;
-            *start |= higher;
-            start++;
-            *start &= LED_LONG_MASK_UPPER_6;
-            *start |= highest;
-            start++;
-        }
+        half = 4;
     }
+    uint16_t index = ((uint16_t)_bufferRow(y) * PANEL_CANVAS_X + x) / 4;
+    _writeSlot((uint8_t *)&PANEL_SHOWN_BUFFER[index], _pixelSlot(half | (x & 3)), _pixelBits(color));
 }
 
 #endif
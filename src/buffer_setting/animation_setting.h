@@ -0,0 +1,86 @@
+#ifndef HUB75NANO_ANIMATION_SETTING_H
+#define HUB75NANO_ANIMATION_SETTING_H
+#ifdef PANEL_FLASH
+
+#include "buffer_common.h"
+#include "../Settings.h"
+
+// frames is a PROGMEM table of count frames, the first one shows from the next refresh on
+// displayBuffer() moves to the next frame once the duration of the current one has passed, always between two refreshes
+// so a frame is never torn, without loop the last frame stays, an empty table stops the animation and keeps the buffer
+void playAnimation(const AnimationFrame *frames, uint8_t count, bool loop = true)
+{
+    if (count == 0)
+    {
+        animation = 0;
+        return;
+    }
+    animation = frames;
+    animation_length = count;
+    animation_loop = loop;
+    animation_frame = 0;
+    buffer = pgm_read_ptr(&frames[0].image);
+    animation_start = millis();
+}
+
+// keeps the current frame
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+stopAnimation()
+{
+    animation = 0;
+}
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline bool
+animationPlaying()
+{
+    return animation != 0;
+}
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline uint8_t
+animationFrame()
+{
+    return animation_frame;
+}
+
+// called by displayBuffer() after every refresh, a late refresh shortens the next frame instead of drifting
+void _advanceAnimation()
+{
+    if (animation == 0)
+    {
+        return;
+    }
+    const unsigned long now = millis();
+    const uint16_t duration = pgm_read_word(&animation[animation_frame].duration);
+    if (now - animation_start < duration)
+    {
+        return;
+    }
+    if (animation_frame + 1 < animation_length)
+    {
+        animation_frame++;
+    }
+    else
+    {
+        if (!animation_loop)
+        {
+            animation = 0;
+            return;
+        }
+        animation_frame = 0;
+    }
+    buffer = pgm_read_ptr(&animation[animation_frame].image);
+    // falling behind by more than a frame starts over from now
+    animation_start = now - animation_start < 2 * (unsigned long)duration ? animation_start + duration : now;
+}
+
+#endif
+#endif // HUB75NANO_ANIMATION_SETTING_H
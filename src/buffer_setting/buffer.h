@@ -4,8 +4,14 @@
 #ifdef PANEL_BIG
 #include "2bit_buffer_setting.h"
 #else
+#ifdef PANEL_PALETTE
+#include "palette_buffer_setting.h"
+#else
 #include "1bit_buffer_setting.h"
 #endif
+#endif
+#include "overlay_buffer_setting.h"
+#include "animation_setting.h"
 
 #ifdef PANEL_MAX_SPEED
 __attribute__((always_inline))
@@ -13,30 +19,352 @@ __attribute__((always_inline))
 inline void
 setBuffer(uint8_t x, uint8_t y, Color color)
 {
+    PANEL_DRAW_HOOK(x, y, 1, color);
 #ifdef PANEL_BIG
     _setBigBuffer(x, y, color); // 1 bit buffer in ram
 #else
 #ifndef PANEL_FLASH
+#ifdef PANEL_PALETTE
+    _setPaletteBuffer(x, y, color); // 2 bit indices in ram
+#else
     _setSmallBuffer(x, y, color); // 2 bit buffer in ram
+#endif
+#else
+#ifdef PANEL_FLASH_OVERLAY
+    _setOverlay(x, y, color); // 1 bit overlay on the flash buffer
+#endif
+#endif
+#endif
+}
+
+// sets x0 to x1 (both included) of row y, clipped to the buffer, nothing if x0 > x1
+// the unaligned ends are set pixel by pixel, the 4 pixel blocks in between get the whole color pattern
+void setSpan(uint8_t x0, uint8_t x1, uint8_t y, Color color)
+{
+    if (x0 > x1 || _offCanvas(x0) || y >= PANEL_Y)
+    {
+        return;
+    }
+    if (_offCanvas(x1))
+    {
+        x1 = PANEL_CANVAS_X - 1;
+    }
+    PANEL_DRAW_HOOK(x0, y, (uint16_t)(x1 - x0 + 1), color);
+#ifndef PANEL_FLASH
+    // flipping
+#ifdef PANEL_FLIP_VERTICAL
+    y = PANEL_Y - y - 1;
+#endif
+#ifdef PANEL_FLIP_HORIZONTAL
+    uint8_t a = PANEL_CANVAS_X - x1 - 1;
+    x1 = PANEL_CANVAS_X - x0 - 1;
+    x0 = a;
+#endif
+    uint8_t half = 0;
+    if (y >= (PANEL_Y / 2))
+    {
+        // we are in lower half of pixels
+        y -= (PANEL_Y / 2);
+        half = 4;
+    }
+#ifdef PANEL_PALETTE
+    _setPaletteSpan(x0, x1, y, half >> 1, color);
 #else
+    LED *row = &PANEL_SHOWN_BUFFER[(uint16_t)_bufferRow(y) * PANEL_CANVAS_X / 4];
+    const uint16_t bits = _pixelBits(color);
+    // exclusive from here on
+    uint16_t x_end = x1 + 1;
+
+    while ((x0 & 3) != 0 && x0 < x_end)
+    {
+        _writeSlot((uint8_t *)&row[x0 / 4], _pixelSlot(half | (x0 & 3)), bits);
+        x0++;
+    }
+    while ((x_end & 3) != 0 && x_end > x0)
+    {
+        x_end--;
+        _writeSlot((uint8_t *)&row[x_end / 4], _pixelSlot(half | (x_end & 3)), bits);
+    }
+    if (x_end > x0)
+    {
+        uint8_t pattern[sizeof(LED)];
+        _expandColor(color, pattern);
+        _writeHalves((uint8_t *)&row[x0 / 4], (uint8_t)((x_end - x0) / 4 * (sizeof(LED) / 3)), half != 0, pattern);
+    }
+#endif
+#else
+#ifdef PANEL_FLASH_OVERLAY
+    _setOverlaySpan(x0, x1, y, color);
 #endif
 #endif
 }
 
+// the pixels x + i of row y whose bit i is set, clipped to the buffer, for glyph lines and other small masks
+// every LED struct the row touches is written once with the masked color pattern instead of pixel by pixel
+void setMasked(int16_t x, int16_t y, uint16_t pixels, Color color)
+{
+    if (y < 0 || y >= PANEL_Y || x >= PANEL_CANVAS_X || x <= -16)
+    {
+        return;
+    }
+    if (x < 0)
+    {
+        pixels >>= -x;
+        x = 0;
+    }
+    if (PANEL_CANVAS_X - x < 16)
+    {
+        pixels &= (uint16_t)((1U << (PANEL_CANVAS_X - x)) - 1);
+    }
+    if (pixels == 0)
+    {
+        return;
+    }
+#if defined(PANEL_FLASH) || defined(PANEL_PALETTE) || defined(PANEL_FLIP_HORIZONTAL)
+    // these layouts have no masked struct write, every run of set pixels is a span
+    for (uint16_t runs = pixels, i = 0; runs != 0;)
+    {
+        if (!(runs & 1))
+        {
+            runs >>= 1;
+            i++;
+            continue;
+        }
+        uint8_t end = i;
+        while (runs & 1)
+        {
+            runs >>= 1;
+            end++;
+        }
+        setSpan(x + i, x + end - 1, y, color);
+        i = end;
+    }
+#else
+    PANEL_MASKED_HOOK(x, y, pixels, color);
+#ifdef PANEL_FLIP_VERTICAL
+    y = PANEL_Y - y - 1;
+#endif
+    uint8_t half = 0;
+    if (y >= (PANEL_Y / 2))
+    {
+        y -= (PANEL_Y / 2);
+        half = 4;
+    }
+    uint8_t pattern[sizeof(LED)];
+    _expandColor(color, pattern);
+    LED *led = &PANEL_SHOWN_BUFFER[((uint16_t)_bufferRow(y) * PANEL_CANVAS_X + x) / 4];
+    // 4 pixels per LED struct, the mask starts at the pixel x has in its struct
+    for (uint32_t bits = (uint32_t)pixels << (x & 3); bits != 0; bits >>= 4, led++)
+    {
+        const uint8_t group = bits & 15;
+        if (group == 15)
+        {
+            _writeHalves((uint8_t *)led, sizeof(LED) / 3, half != 0, pattern);
+        }
+        else if (group != 0)
+        {
+            uint8_t masks[sizeof(LED)];
+            _groupMask(group, half, masks);
+            _writeMasked((uint8_t *)led, masks, pattern);
+        }
+    }
+#endif
+}
+
+#ifndef PANEL_FLASH
+// fills the rows y0 to y1 (both included), fillRows(0, PANEL_Y / 2 - 1, color) is the upper half
+// a row whose partner in the other half is filled too gets the plain pattern, otherwise only its half is written
+void fillRows(uint8_t y0, uint8_t y1, Color color)
+{
+    if (y1 >= PANEL_Y)
+    {
+        y1 = PANEL_Y - 1;
+    }
+    if (y0 > y1)
+    {
+        return;
+    }
+    for (uint8_t y = y0; y <= y1; y++)
+    {
+        PANEL_DRAW_HOOK(0, y, PANEL_CANVAS_X, color);
+    }
+#ifdef PANEL_FLIP_VERTICAL
+    uint8_t a = PANEL_Y - y1 - 1;
+    y1 = PANEL_Y - y0 - 1;
+    y0 = a;
+#endif
+#ifdef PANEL_PALETTE
+    const uint8_t bits = _palettePattern(color);
+#else
+    uint8_t pattern[sizeof(LED)];
+    _expandColor(color, pattern);
+    // 3 byte groups per row
+    const uint8_t groups = PANEL_CANVAS_X / 4 * (sizeof(LED) / 3);
+#endif
+    for (uint8_t row = 0; row < PANEL_Y / 2; row++)
+    {
+        const bool upper = row >= y0 && row <= y1;
+        const bool lower = row + PANEL_Y / 2 >= y0 && row + PANEL_Y / 2 <= y1;
+#ifdef PANEL_PALETTE
+        uint8_t *start = &buffer[(uint16_t)_bufferRow(row) * (PANEL_X / 2)];
+        if (upper && lower)
+        {
+            memset(start, bits, PANEL_X / 2);
+        }
+        else if (upper || lower)
+        {
+            // the upper half is in bits 0-1 of every nibble
+            const uint8_t mask = lower ? (uint8_t)0b11001100 : (uint8_t)0b00110011;
+            for (uint8_t i = 0; i < PANEL_X / 2; i++)
+            {
+                start[i] = (start[i] & (uint8_t)~mask) | (bits & mask);
+            }
+        }
+#else
+        uint8_t *start = (uint8_t *)&PANEL_SHOWN_BUFFER[(uint16_t)_bufferRow(row) * PANEL_CANVAS_X / 4];
+        if (upper && lower)
+        {
+            _writePattern(start, groups, pattern);
+        }
+        else if (upper || lower)
+        {
+            _writeHalves(start, groups, lower, pattern);
+        }
+#endif
+    }
+}
+
+// moves the image n rows up, the rows that come in at the bottom get fill
+// only the n buffer rows whose rows cross from one half into the other are rewritten, the rest just moves with row_origin
+void scrollUp(uint8_t n, Color fill)
+{
+#ifdef PANEL_FLIP_VERTICAL
+    _scrollBuffer(n, false, fill);
+#else
+    _scrollBuffer(n, true, fill);
+#endif
+}
+
 #ifdef PANEL_MAX_SPEED
 __attribute__((always_inline))
 #endif
 inline void
-_setBuffer4xBlockWise(uint8_t x, uint8_t y, uint8_t block_count, Color color)
+scrollUp(uint8_t n)
+{
+    scrollUp(n, Colors::BLACK);
+}
+
+// moves the image n rows down, the rows that come in at the top get fill
+void scrollDown(uint8_t n, Color fill)
+{
+#ifdef PANEL_FLIP_VERTICAL
+    _scrollBuffer(n, true, fill);
+#else
+    _scrollBuffer(n, false, fill);
+#endif
+}
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+scrollDown(uint8_t n)
+{
+    scrollDown(n, Colors::BLACK);
+}
+
+// scrolls the buffer rows (without flipping), up moves the lower half of the first n buffer rows into their upper half
+// and row_origin past them, down does the reverse on the n buffer rows before row_origin
+void _scrollBuffer(uint8_t n, bool up, Color fill)
 {
+    if (n >= PANEL_Y)
+    {
+        fillRows(0, PANEL_Y - 1, fill);
+        return;
+    }
+#ifdef PANEL_PALETTE
+    const uint8_t bits = _palettePattern(fill);
+#else
 #ifdef PANEL_BIG
-    _setBigBuffer4x(x, y, block_count, color); // 1 bit buffer in ram
+    const uint8_t upper_1 = LED_LONG_MASK_UPPER_1, upper_2 = LED_LONG_MASK_UPPER_2, upper_3 = LED_LONG_MASK_UPPER_3;
 #else
-#ifndef PANEL_FLASH
-    _setSmallBuffer4x(x, y, block_count, color); // 2 bit buffer in ram
+    const uint8_t upper_1 = LED_SHORT_MASK_UPPER_1, upper_2 = LED_SHORT_MASK_UPPER_2, upper_3 = LED_SHORT_MASK_UPPER_3;
+#endif
+    uint8_t pattern[sizeof(LED)];
+    _expandColor(fill, pattern);
+    // 3 byte groups per row
+    const uint8_t groups = PANEL_CANVAS_X / 4 * (sizeof(LED) / 3);
+#endif
+    while (n > 0)
+    {
+        // a row crosses at most one half per pass
+        const uint8_t step = n < (PANEL_Y / 2) ? n : (PANEL_Y / 2);
+        for (uint8_t i = 0; i < step; i++)
+        {
+#ifdef PANEL_PALETTE
+            uint8_t *start = &buffer[(uint16_t)_bufferRow(up ? i : (PANEL_Y / 2) - 1 - i) * (PANEL_X / 2)];
+            for (uint8_t j = 0; j < PANEL_X / 2; j++)
+            {
+                // the lower index of every pixel sits 2 bits above the upper one
+                if (up)
+                {
+                    start[j] = ((start[j] >> 2) & (uint8_t)0b00110011) | (bits & (uint8_t)0b11001100);
+                }
+                else
+                {
+                    start[j] = ((start[j] << 2) & (uint8_t)0b11001100) | (bits & (uint8_t)0b00110011);
+                }
+            }
 #else
+            uint8_t *start = (uint8_t *)&PANEL_SHOWN_BUFFER[(uint16_t)_bufferRow(up ? i : (PANEL_Y / 2) - 1 - i) * PANEL_CANVAS_X / 4];
+            for (uint8_t j = 0; j < groups; j++)
+            {
+                // the lower half of every pixel sits 3 bits above the upper one, the groups are shifted bytewise
+                if (up)
+                {
+                    start[0] = (((start[0] >> 3) | (start[1] << 5)) & upper_1) | (pattern[0] & ~upper_1);
+                    start[1] = (((start[1] >> 3) | (start[2] << 5)) & upper_2) | (pattern[1] & ~upper_2);
+                    start[2] = ((start[2] >> 3) & upper_3) | (pattern[2] & ~upper_3);
+                }
+                else
+                {
+                    start[2] = (((start[2] << 3) | (start[1] >> 5)) & ~upper_3) | (pattern[2] & upper_3);
+                    start[1] = (((start[1] << 3) | (start[0] >> 5)) & ~upper_2) | (pattern[1] & upper_2);
+                    start[0] = ((start[0] << 3) & ~upper_1) | (pattern[0] & upper_1);
+                }
+                start += 3;
+            }
 #endif
+        }
+        row_origin = _bufferRow(up ? step : (PANEL_Y / 2) - step);
+        n -= step;
+    }
+}
+
+// the panel shows the buffer columns x to x + PANEL_X - 1, clamped to the PANEL_CANVAS_X wide buffer
+// moving it scrolls horizontally without redrawing anything, nothing changes if the buffer is as wide as the panel
+void setViewport(uint8_t x)
+{
+    if (x > PANEL_CANVAS_X - PANEL_X)
+    {
+        x = PANEL_CANVAS_X - PANEL_X;
+    }
+#ifdef PANEL_FLIP_HORIZONTAL
+    x = PANEL_CANVAS_X - PANEL_X - x;
 #endif
+    view_led = x / 4;
+    view_shift = x & 3;
+}
+#endif
+
+// block_count blocks of 4 pixels starting at the 4 aligned x
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+_setBuffer4xBlockWise(uint8_t x, uint8_t y, uint8_t block_count, Color color)
+{
+    setSpan(x, x + block_count * 4 - 1, y, color);
 }
 
 #endif // HUB75NANO_BUFFER_H
\ No newline at end of file
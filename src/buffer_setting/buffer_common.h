@@ -16,13 +16,200 @@ LED buffer[PANEL_BUFFERSIZE]; // uses 768 bytes on max size display with 1 bit,
 #else
 #ifdef PANEL_FLASH
 PGM_VOID_P buffer = 0;
+#ifdef PANEL_FLASH_OVERLAY
+// 1 bit per pixel on top of the flash image, 256 bytes on a 64x32 panel
+uint8_t overlay[PANEL_Y * PANEL_X / 8] = {};
+// the rgb bits of the overlay color for each of the 4 passes, white until setOverlayColor
+uint8_t overlay_planes[4] = {7, 7, 7, 7};
+#endif
+// the frame table playAnimation() got, 0 while no animation plays
+const AnimationFrame *animation = 0;
+uint8_t animation_length = 0;
+uint8_t animation_frame = 0;
+bool animation_loop = false;
+// millis() when the current frame was due
+unsigned long animation_start = 0;
+#if defined(PANEL_FLASH_RLE) && defined(PANEL_FLIP_HORIZONTAL)
+// the runs only decode forwards, a flipped row is collected here and shifted out backwards
+uint8_t rle_row[PANEL_X];
+#endif
+#else
+#ifdef PANEL_PALETTE
+// 2 bit palette indices, 512 bytes on a 64x32 panel
+uint8_t buffer[PANEL_BUFFERSIZE];
+// the colors of the 4 indices, 4 bits per channel, a grey ramp until setPalette
+Color palette_colors[4] = {COLOR_888_to_444(0, 0, 0), COLOR_888_to_444(5, 5, 5), COLOR_888_to_444(10, 10, 10), COLOR_888_to_444(15, 15, 15)};
+// the rgb bits of both halves for every nibble in each of the 4 passes, rebuilt from palette_colors before the next frame
+uint8_t palette_planes[4][16];
+bool palette_changed = true;
 #else
 LED buffer[PANEL_BUFFERSIZE];
 #endif
 #endif
+#endif
 #else
 LED buffer[0];
 #endif
+
+#ifdef PANEL_TEXT_MODE
+// the tile of every cell, row after row, 80 bytes on a 64x32 panel, buffer only holds the row that is shifted out
+uint8_t text_cells[PANEL_TEXT_ROWS * PANEL_TEXT_COLS] = {};
+// foreground rgb in bits 0-2 and background rgb in bits 3-5 of every cell, all black until set
+uint8_t text_colors[PANEL_TEXT_ROWS * PANEL_TEXT_COLS] = {};
+// PANEL_TILE_Y bytes per tile in PROGMEM, the character of tile 0
+const uint8_t *tileset = &tiles4x6[0][0];
+uint8_t tileset_first = 32;
+#endif
+
+#ifndef PANEL_FLASH
+// the buffer row that holds the first row of each half, buffer rows wrap around at PANEL_Y / 2
+// scrollUp and scrollDown move it instead of the whole image
+uint8_t row_origin = 0;
+
+// the buffer row that holds row y of the upper half (and y + PANEL_Y / 2 of the lower one), y < PANEL_Y / 2
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline uint8_t
+_bufferRow(uint8_t y)
+{
+    y += row_origin;
+    if (y >= (PANEL_Y / 2))
+    {
+        y -= (PANEL_Y / 2);
+    }
+    return y;
+}
+
+// the first buffer column the panel shows, as the LED struct it is in and the pixels before it in that struct
+// the output shifts out view_shift pixels more than the panel is wide, the first ones fall out of the row again
+uint8_t view_led = 0;
+uint8_t view_shift = 0;
+#endif
+
+// x is right of the buffer, never with a 256 pixel wide one since x is a uint8_t
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline bool
+_offCanvas(uint8_t x)
+{
+#if PANEL_CANVAS_X < 256
+    return x >= PANEL_CANVAS_X;
+#else
+    (void)x;
+    return false;
+#endif
+}
 #pragma endregion // buffer_definition
 
+#pragma region pixel_slots
+#ifndef PANEL_FLASH
+// the rgb bits of one pixel in the order of the LED struct fields, bit is the bit of color depth
+inline uint8_t _channelBits(Color color, uint8_t bit)
+{
+#ifdef PANEL_COLOR_INVERSION
+    return ((color.blue >> bit) & 1) | (((color.green >> bit) & 1) << 1) | (((color.red >> bit) & 1) << 2);
+#else
+    return ((color.red >> bit) & 1) | (((color.green >> bit) & 1) << 1) | (((color.blue >> bit) & 1) << 2);
+#endif
+}
+
+// spreads a 12 bit group (the bits of one pixel in both halves) over 3 bytes, the LED structs repeat every 24 bits
+inline void _spreadGroup(uint16_t group, uint8_t *pattern)
+{
+    pattern[0] = group;
+    pattern[1] = (group >> 8) | (group << 4);
+    pattern[2] = group >> 4;
+}
+
+// writes one pixel, slot is a {byte offset, 1 << shift, mask, mask of the next byte} row of a PROGMEM table
+// and bits the pixel in field order, the multiply replaces a variable shift, which avr only has as a loop
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+_writeSlot(uint8_t *led, const uint8_t *slot, uint16_t bits)
+{
+    const uint8_t offset = pgm_read_byte(&slot[0]);
+    const uint16_t value = bits * pgm_read_byte(&slot[1]);
+    const uint8_t mask = pgm_read_byte(&slot[2]);
+    const uint8_t next_mask = pgm_read_byte(&slot[3]);
+    led[offset] = (led[offset] & ~mask) | (uint8_t)value;
+    if (next_mask)
+    {
+        led[offset + 1] = (led[offset + 1] & ~next_mask) | (uint8_t)(value >> 8);
+    }
+}
+
+// writes all 4 pixels of one half into count consecutive 3 byte groups (one per LED_short, two per LED_long)
+inline void _writeHalves(uint8_t *start, uint8_t count, bool lower_half, const uint8_t *pattern)
+{
+#ifdef PANEL_BIG
+    // the LED_long masks repeat after 3 bytes as well
+    const uint8_t upper_1 = LED_LONG_MASK_UPPER_1, upper_2 = LED_LONG_MASK_UPPER_2, upper_3 = LED_LONG_MASK_UPPER_3;
+#else
+    const uint8_t upper_1 = LED_SHORT_MASK_UPPER_1, upper_2 = LED_SHORT_MASK_UPPER_2, upper_3 = LED_SHORT_MASK_UPPER_3;
+#endif
+    const uint8_t mask_1 = lower_half ? (uint8_t)~upper_1 : upper_1;
+    const uint8_t mask_2 = lower_half ? (uint8_t)~upper_2 : upper_2;
+    const uint8_t mask_3 = lower_half ? (uint8_t)~upper_3 : upper_3;
+    const uint8_t bits_1 = pattern[0] & mask_1;
+    const uint8_t bits_2 = pattern[1] & mask_2;
+    const uint8_t bits_3 = pattern[2] & mask_3;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        start[0] = (start[0] & ~mask_1) | bits_1;
+        start[1] = (start[1] & ~mask_2) | bits_2;
+        start[2] = (start[2] & ~mask_3) | bits_3;
+        start += 3;
+    }
+}
+
+#if !defined(PANEL_PALETTE) && !defined(PANEL_TEXT_MODE) && !defined(PANEL_NO_BUFFER)
+// the bits of one LED struct that belong to the pixels of one half, bit p of pixels is pixel p of the 4
+inline void _groupMask(uint8_t pixels, uint8_t half, uint8_t *masks)
+{
+    memset(masks, 0, sizeof(LED));
+    for (uint8_t p = 0; p < 4; p++, pixels >>= 1)
+    {
+        if (pixels & 1)
+        {
+            const uint8_t *slot = _pixelSlot(half | p);
+            const uint8_t offset = pgm_read_byte(&slot[0]);
+            masks[offset] |= pgm_read_byte(&slot[2]);
+            masks[offset + 1] |= pgm_read_byte(&slot[3]);
+        }
+    }
+}
+
+// writes the pattern into the bits of masks and leaves the rest of the LED struct
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+_writeMasked(uint8_t *led, const uint8_t *masks, const uint8_t *pattern)
+{
+    for (uint8_t i = 0; i < sizeof(LED); i++)
+    {
+        led[i] = (led[i] & ~masks[i]) | (pattern[i] & masks[i]);
+    }
+}
+#endif
+
+// writes the whole pattern into count consecutive 3 byte groups, both halves
+inline void _writePattern(uint8_t *start, uint16_t count, const uint8_t *pattern)
+{
+    const uint8_t bits_1 = pattern[0], bits_2 = pattern[1], bits_3 = pattern[2];
+    for (uint16_t i = 0; i < count; i++)
+    {
+        start[0] = bits_1;
+        start[1] = bits_2;
+        start[2] = bits_3;
+        start += 3;
+    }
+}
+#endif
+#pragma endregion // pixel_slots
+
 #endif // HUB75NANO_BUFFER_COMMON_H
\ No newline at end of file
@@ -0,0 +1,87 @@
+#ifndef HUB75NANO_OVERLAY_BUFFER_SETTING_H
+#define HUB75NANO_OVERLAY_BUFFER_SETTING_H
+#ifdef PANEL_FLASH_OVERLAY
+
+#include "buffer_common.h"
+#include "../Settings.h"
+
+// the overlay is stored unflipped like the flash image, the output flips both together
+// one bit per pixel, row after row, the leftmost pixel of every byte is bit 0
+
+// the color all set overlay pixels show, 4 bits per channel (COLOR_888_to_444(15, 15, 15) is full white)
+void setOverlayColor(Color color)
+{
+    for (uint8_t plane = 0; plane < 4; plane++)
+    {
+        // the first plane holds the most significant bit
+        const uint8_t bit = 3 - plane;
+#ifdef PANEL_COLOR_INVERSION
+        overlay_planes[plane] = ((color.blue >> bit) & 1) | (((color.green >> bit) & 1) << 1) | (((color.red >> bit) & 1) << 2);
+#else
+        overlay_planes[plane] = ((color.red >> bit) & 1) | (((color.green >> bit) & 1) << 1) | (((color.blue >> bit) & 1) << 2);
+#endif
+    }
+}
+
+// black clears overlay pixels so the background shows again, every other color sets them
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline bool
+_overlaySet(Color color)
+{
+    return (color.red | color.green | color.blue) != 0;
+}
+
+void _setOverlay(uint8_t x, uint8_t y, Color color)
+{
+    // dont bother if outside of the panel
+    if (x >= PANEL_X || y >= PANEL_Y)
+    {
+        return;
+    }
+    uint8_t *pixels = &overlay[(uint16_t)y * (PANEL_X / 8) + x / 8];
+    if (_overlaySet(color))
+    {
+        *pixels |= (uint8_t)(1 << (x & 7));
+    }
+    else
+    {
+        *pixels &= (uint8_t)~(1 << (x & 7));
+    }
+}
+
+// x0 to x1 (both included, already clipped) of row y, whole bytes in between are written at once
+void _setOverlaySpan(uint8_t x0, uint8_t x1, uint8_t y, Color color)
+{
+    uint8_t *row = &overlay[(uint16_t)y * (PANEL_X / 8)];
+    const uint8_t fill = _overlaySet(color) ? 0xff : 0;
+    while ((x0 & 7) != 0 && x0 <= x1)
+    {
+        row[x0 / 8] = (row[x0 / 8] & (uint8_t)~(1 << (x0 & 7))) | (fill & (uint8_t)(1 << (x0 & 7)));
+        x0++;
+    }
+    while (x0 + 7 <= x1)
+    {
+        row[x0 / 8] = fill;
+        x0 += 8;
+    }
+    while (x0 <= x1)
+    {
+        row[x0 / 8] = (row[x0 / 8] & (uint8_t)~(1 << (x0 & 7))) | (fill & (uint8_t)(1 << (x0 & 7)));
+        x0++;
+    }
+}
+
+// removes the whole overlay, only the flash image is left
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+clearOverlay()
+{
+    memset(overlay, 0, sizeof(overlay));
+}
+
+#endif
+#endif // HUB75NANO_OVERLAY_BUFFER_SETTING_H
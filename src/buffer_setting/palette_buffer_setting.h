@@ -0,0 +1,119 @@
+#ifndef HUB75NANO_PALETTE_BUFFER_SETTING_H
+#define HUB75NANO_PALETTE_BUFFER_SETTING_H
+#ifdef PANEL_PALETTE
+
+#include "buffer_common.h"
+#include "../Settings.h"
+
+// one nibble per column of a buffer row, the upper half index in bits 0-1 and the lower half index in bits 2-3
+// the even column sits in the low nibble, the drawing color is the index (its red channel, Colors::INDEX_0 to INDEX_3)
+
+// the index of the drawing color
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline uint8_t
+_paletteIndex(Color color)
+{
+    return color.red & 3;
+}
+
+// index shows color from the next frame on, 4 bits per channel (COLOR_888_to_444(15, 15, 15) is full white)
+// nothing in the buffer is touched, all pixels with that index change at once
+void setPalette(uint8_t index, Color color)
+{
+    palette_colors[index & 3] = color;
+    palette_changed = true;
+}
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline Color
+getPalette(uint8_t index)
+{
+    return palette_colors[index & 3];
+}
+
+// the output looks up the rgb bits of both halves of a pixel in the table of the current pass
+void _buildPalettePlanes()
+{
+    for (uint8_t plane = 0; plane < 4; plane++)
+    {
+        // the first plane holds the most significant bit
+        const uint8_t bit = 3 - plane;
+        uint8_t rgb[4];
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            rgb[i] = _channelBits(palette_colors[i], bit);
+        }
+        for (uint8_t nibble = 0; nibble < 16; nibble++)
+        {
+            palette_planes[plane][nibble] = rgb[nibble & 3] | (uint8_t)(rgb[nibble >> 2] << 3);
+        }
+    }
+    palette_changed = false;
+}
+
+void _setPaletteBuffer(uint8_t x, uint8_t y, Color color)
+{
+    // dont bother if outside of the panel
+    if (x >= PANEL_X || y >= PANEL_Y)
+    {
+        return;
+    }
+    // flipping
+#ifdef PANEL_FLIP_VERTICAL
+    y = PANEL_Y - y - 1;
+#endif
+#ifdef PANEL_FLIP_HORIZONTAL
+    x = PANEL_X - x - 1;
+#endif
+    uint8_t shift = (x & 1) << 2;
+    if (y >= (PANEL_Y / 2))
+    {
+        // we are in lower half of pixels
+        y -= (PANEL_Y / 2);
+        shift += 2;
+    }
+    uint8_t *pixels = &buffer[(uint16_t)_bufferRow(y) * (PANEL_X / 2) + x / 2];
+    *pixels = (*pixels & (uint8_t)~(3 << shift)) | (uint8_t)(_paletteIndex(color) << shift);
+}
+
+// the index in all 4 slots of a byte, mask keeps one half
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline uint8_t
+_palettePattern(Color color)
+{
+    const uint8_t index = _paletteIndex(color);
+    return index * (uint8_t)0b01010101;
+}
+
+// x0 to x1 (both included, clipped and flipped) of buffer row row, half is 0 for the upper and 2 for the lower half
+// whole bytes in between are written at once
+void _setPaletteSpan(uint8_t x0, uint8_t x1, uint8_t row, uint8_t half, Color color)
+{
+    uint8_t *pixels = &buffer[(uint16_t)_bufferRow(row) * (PANEL_X / 2)];
+    const uint8_t index = _paletteIndex(color);
+    const uint8_t mask = (uint8_t)0b00110011 << half;
+    const uint8_t bits = _palettePattern(color) & mask;
+    if (x0 & 1)
+    {
+        pixels[x0 / 2] = (pixels[x0 / 2] & (uint8_t)~(3 << (half + 4))) | (uint8_t)(index << (half + 4));
+        x0++;
+    }
+    while (x0 < x1)
+    {
+        pixels[x0 / 2] = (pixels[x0 / 2] & (uint8_t)~mask) | bits;
+        x0 += 2;
+    }
+    if (x0 == x1)
+    {
+        pixels[x0 / 2] = (pixels[x0 / 2] & (uint8_t)~(3 << half)) | (uint8_t)(index << half);
+    }
+}
+
+#endif
+#endif // HUB75NANO_PALETTE_BUFFER_SETTING_H
@@ -0,0 +1,93 @@
+#ifndef HUB75NANO_TEXT_BUFFER_SETTING_H
+#define HUB75NANO_TEXT_BUFFER_SETTING_H
+#ifdef PANEL_TEXT_MODE
+
+#include "buffer_common.h"
+#include "../Settings.h"
+
+// the panel is a grid of PANEL_TEXT_COLS x PANEL_TEXT_ROWS cells of 4 x PANEL_TILE_Y pixels (16x5 on a 64x32 panel)
+// every cell holds one tile and its own foreground and background color, the output renders the pixels row by row
+// colors are 1 bit per channel like the 1 bit buffer, rows below the last whole cell stay black
+
+// the cell color byte
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline uint8_t
+_textColor(Color fg, Color bg)
+{
+    return _channelBits(fg, 0) | (_channelBits(bg, 0) << 3);
+}
+
+// tiles is PANEL_TILE_Y bytes per tile in PROGMEM, one byte per row with the leftmost pixel in bit 3
+// first is the character shown by the first tile, the cells keep their tile numbers when the tileset changes
+void setTileset(const uint8_t *tiles, uint8_t first)
+{
+    tileset = tiles;
+    tileset_first = first;
+}
+
+// puts letter into the cell, letters without a tile leave it as it is
+void setCell(uint8_t col, uint8_t row, char letter, Color fg, Color bg)
+{
+    if (col >= PANEL_TEXT_COLS || row >= PANEL_TEXT_ROWS || (uint8_t)letter < tileset_first)
+    {
+        return;
+    }
+    const uint8_t cell = row * PANEL_TEXT_COLS + col;
+    text_cells[cell] = (uint8_t)letter - tileset_first;
+    text_colors[cell] = _textColor(fg, bg);
+}
+
+// recolors the cell without touching its tile
+void setCellColor(uint8_t col, uint8_t row, Color fg, Color bg)
+{
+    if (col >= PANEL_TEXT_COLS || row >= PANEL_TEXT_ROWS)
+    {
+        return;
+    }
+    text_colors[row * PANEL_TEXT_COLS + col] = _textColor(fg, bg);
+}
+
+// writes text from col on, cut off at the end of the row, returns the column after the last letter
+uint8_t printText(uint8_t col, uint8_t row, const char *text, Color fg, Color bg)
+{
+    if (row >= PANEL_TEXT_ROWS)
+    {
+        return col;
+    }
+    const uint8_t colors = _textColor(fg, bg);
+    uint8_t *cells = &text_cells[row * PANEL_TEXT_COLS];
+    uint8_t *cell_colors = &text_colors[row * PANEL_TEXT_COLS];
+    while (*text != 0 && col < PANEL_TEXT_COLS)
+    {
+        if ((uint8_t)*text >= tileset_first)
+        {
+            cells[col] = (uint8_t)*text - tileset_first;
+            cell_colors[col] = colors;
+        }
+        text++;
+        col++;
+    }
+    return col;
+}
+
+// every cell gets the blank tile (space, or the first tile if the tileset starts after it) on bg
+void clearText(Color bg)
+{
+    const uint8_t blank = tileset_first <= ' ' ? ' ' - tileset_first : 0;
+    memset(text_cells, blank, sizeof(text_cells));
+    memset(text_colors, _textColor(bg, bg), sizeof(text_colors));
+}
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+clearText()
+{
+    clearText(Colors::BLACK);
+}
+
+#endif
+#endif // HUB75NANO_TEXT_BUFFER_SETTING_H
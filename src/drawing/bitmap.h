@@ -0,0 +1,178 @@
+#ifndef HUB75NANO_BITMAP_H
+#define HUB75NANO_BITMAP_H
+
+#include "drawing_common.h"
+
+// bitmaps are stored row by row, every row starts on a whole byte and the leftmost pixel sits in the most significant bits
+// (the format of the adafruit gfx drawBitmap and of most image converters)
+
+// 1 bit mask in PROGMEM, set bits get fg, clear bits bg, Colors::NO_COLOR leaves those pixels as they are
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+drawBitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *mask, Color fg, Color bg)
+{
+    const Color palette[2] = {bg, fg};
+    _drawBitmap(x, y, w, h, mask, true, 1, palette);
+}
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+drawBitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *mask, Color fg)
+{
+    drawBitmap(x, y, w, h, mask, fg, Colors::NO_COLOR);
+}
+
+// same as drawBitmap, for a mask in ram
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+drawRamBitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *mask, Color fg, Color bg)
+{
+    const Color palette[2] = {bg, fg};
+    _drawBitmap(x, y, w, h, mask, false, 1, palette);
+}
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+drawRamBitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *mask, Color fg)
+{
+    drawRamBitmap(x, y, w, h, mask, fg, Colors::NO_COLOR);
+}
+
+// indexed bitmap in PROGMEM with 1, 2 or 4 bits per pixel, the palette (in ram) has 2, 4 or 16 colors
+// Colors::NO_COLOR entries are transparent
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+drawIndexedBitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *data, uint8_t bits, const Color *palette)
+{
+    _drawBitmap(x, y, w, h, data, true, bits, palette);
+}
+
+// same as drawIndexedBitmap, for data in ram
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+drawRamIndexedBitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *data, uint8_t bits, const Color *palette)
+{
+    _drawBitmap(x, y, w, h, data, false, bits, palette);
+}
+
+#if defined(PANEL_FLASH_OVERLAY) || defined(PANEL_PALETTE)
+// the overlay and the palette buffer have no LED structs, the pixels go through setBuffer one by one
+void _drawBitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *data, bool in_flash, uint8_t bits, const Color *palette)
+{
+    const uint8_t index_mask = (1 << bits) - 1;
+    const uint8_t stride = ((uint16_t)w * bits + 7) / 8;
+    for (uint8_t i = 0; i < h && y + i < PANEL_Y; i++)
+    {
+        const uint8_t *line = data + (uint16_t)i * stride;
+        for (uint8_t j = 0; j < w && x + j < PANEL_X; j++)
+        {
+            const uint16_t bit = (uint16_t)j * bits;
+            const uint8_t current = in_flash ? pgm_read_byte(&line[bit / 8]) : line[bit / 8];
+            const Color color = palette[(current >> (8 - bits - (bit & 7))) & index_mask];
+            if (color.invalid_bits == 0)
+            {
+                setBuffer(x + j, y + i, color);
+            }
+        }
+    }
+}
+#else
+// clips at the right and bottom edge, every 4 pixels that share a LED struct are collected and written with one masked store per byte
+void _drawBitmap(uint8_t x, uint8_t y, uint8_t w, uint8_t h, const uint8_t *data, bool in_flash, uint8_t bits, const Color *palette)
+{
+    if (_offCanvas(x) || y >= PANEL_Y)
+    {
+        return;
+    }
+    // the pixel bits of every palette entry, transparent ones are 0xffff
+    uint16_t entries[16];
+    const uint8_t entry_count = 1 << bits;
+    for (uint8_t i = 0; i < entry_count; i++)
+    {
+        entries[i] = palette[i].invalid_bits == 0 ? _pixelBits(palette[i]) : 0xffff;
+    }
+    const uint8_t index_mask = entry_count - 1;
+    const uint8_t stride = ((uint16_t)w * bits + 7) / 8;
+    // pixels of the bitmap that are still on the panel
+    const uint8_t visible_w = min((uint16_t)w, (uint16_t)(PANEL_CANVAS_X - x));
+    const uint8_t visible_h = min((uint16_t)h, (uint16_t)(PANEL_Y - y));
+
+    for (uint8_t i = 0; i < visible_h; i++)
+    {
+        uint8_t row_y = y + i;
+#ifdef PANEL_FLIP_VERTICAL
+        row_y = PANEL_Y - row_y - 1;
+#endif
+        uint8_t half = 0;
+        if (row_y >= (PANEL_Y / 2))
+        {
+            // we are in lower half of pixels
+            row_y -= (PANEL_Y / 2);
+            half = 4;
+        }
+        LED *row = &PANEL_SHOWN_BUFFER[(uint16_t)_bufferRow(row_y) * PANEL_CANVAS_X / 4];
+        const uint8_t *line = data + (uint16_t)i * stride;
+
+        uint8_t current = 0;
+        // one spare byte, the last pixel of a LED_short has an empty next byte mask
+        uint8_t values[sizeof(LED) + 1] = {0};
+        uint8_t masks[sizeof(LED) + 1] = {0};
+        for (uint8_t j = 0; j < visible_w; j++)
+        {
+            // next byte of the bitmap
+            const uint16_t bit = (uint16_t)j * bits;
+            if ((bit & 7) == 0)
+            {
+                current = in_flash ? pgm_read_byte(&line[bit / 8]) : line[bit / 8];
+            }
+            const uint8_t entry = (current >> (8 - bits - (bit & 7))) & index_mask;
+
+            uint8_t pixel_x = x + j;
+            if (entries[entry] != 0xffff)
+            {
+                PANEL_DRAW_HOOK(pixel_x, y + i, 1, palette[entry]);
+#ifdef PANEL_FLIP_HORIZONTAL
+                pixel_x = PANEL_CANVAS_X - pixel_x - 1;
+#endif
+                const uint8_t *slot = _pixelSlot(half | (pixel_x & 3));
+                const uint8_t offset = pgm_read_byte(&slot[0]);
+                const uint16_t value = entries[entry] * pgm_read_byte(&slot[1]);
+                values[offset] |= (uint8_t)value;
+                values[offset + 1] |= (uint8_t)(value >> 8);
+                masks[offset] |= pgm_read_byte(&slot[2]);
+                masks[offset + 1] |= pgm_read_byte(&slot[3]);
+            }
+
+            // the last pixel of this LED struct, write the collected ones
+            if (((x + j) & 3) == 3 || j == visible_w - 1)
+            {
+#ifdef PANEL_FLIP_HORIZONTAL
+                uint8_t *led = (uint8_t *)&row[(PANEL_CANVAS_X - (x + j) - 1) / 4];
+#else
+                uint8_t *led = (uint8_t *)&row[(x + j) / 4];
+#endif
+                for (uint8_t k = 0; k < sizeof(LED); k++)
+                {
+                    led[k] = (led[k] & ~masks[k]) | values[k];
+                    values[k] = 0;
+                    masks[k] = 0;
+                }
+            }
+        }
+    }
+}
+
+#endif
+#endif // HUB75NANO_BITMAP_H
@@ -6,43 +6,322 @@
 #include "rectangle.h"
 #include "../fonts/font_common.h"
 
+// text is only drawn inside this rectangle (both corners included), the whole canvas until setTextClip()
+int16_t text_clip_x0 = 0;
+int16_t text_clip_y0 = 0;
+int16_t text_clip_x1 = PANEL_CANVAS_X - 1;
+int16_t text_clip_y1 = PANEL_Y - 1;
+
+// limits all text drawing to the rectangle from x1, y1 to x2, y2, cut down to the canvas
+void setTextClip(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+    text_clip_x0 = max(x1, (int16_t)0);
+    text_clip_y0 = max(y1, (int16_t)0);
+    text_clip_x1 = min(x2, (int16_t)(PANEL_CANVAS_X - 1));
+    text_clip_y1 = min(y2, (int16_t)(PANEL_Y - 1));
+}
+
 #ifdef PANEL_MAX_SPEED
 __attribute__((always_inline))
 #endif
 inline void
-drawChar(uint8_t x, uint8_t y, char letter, Color color)
+clearTextClip()
 {
-    drawChar(x, y, letter, color, Colors::NO_COLOR);
+    setTextClip(0, 0, PANEL_CANVAS_X - 1, PANEL_Y - 1);
 }
 
-void drawChar(uint8_t x, uint8_t y, char letter, Color color, const Color bg_color)
+// x0 to x1 of rows rows from y on, clipped to the text clip, the glyphs are blitted as these runs
+void _fillSpanRows(int16_t x0, int16_t x1, int16_t y, uint16_t rows, Color color)
 {
-    // iterate through the character line by line
-    for (uint8_t i = 0; i < PANEL_FONT_Y; i++)
+    if (x0 < text_clip_x0)
+    {
+        x0 = text_clip_x0;
+    }
+    if (x1 > text_clip_x1)
+    {
+        x1 = text_clip_x1;
+    }
+    if (x0 > x1)
+    {
+        return;
+    }
+    if (y < text_clip_y0)
+    {
+        if ((int32_t)y + rows <= text_clip_y0)
+        {
+            return;
+        }
+        rows -= text_clip_y0 - y;
+        y = text_clip_y0;
+    }
+    for (; rows > 0 && y <= text_clip_y1; rows--, y++)
+    {
+        setSpan(x0, x1, y, color);
+    }
+}
+
+#if PANEL_FONT == 2
+// the GFXfont of drawChar and drawString, 0 for the 3x5 font
+const GFXfont *gfx_font = 0;
+// rows from the top of a line to the baseline, so y stays the top like with the 3x5 font
+uint8_t gfx_ascent = 0;
+
+// switches to font (a GFXfont in PROGMEM) for all text from now on, 0 goes back to the 3x5 font
+void setFont(const GFXfont *font)
+{
+    gfx_font = font;
+    gfx_ascent = 0;
+    if (font == 0)
+    {
+        return;
+    }
+    // the highest glyph, once per switch instead of per character
+    const GFXglyph *glyph = (const GFXglyph *)pgm_read_ptr(&font->glyph);
+    for (uint16_t letter = pgm_read_word(&font->first); letter <= pgm_read_word(&font->last); letter++, glyph++)
+    {
+        const int8_t top = (int8_t)pgm_read_byte(&glyph->yOffset);
+        if (-top > gfx_ascent)
+        {
+            gfx_ascent = -top;
+        }
+    }
+}
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+setFont()
+{
+    setFont(0);
+}
+
+// a glyph of gfx_font with its upper line edge at y, every row as runs of set bits, size times larger
+// the background fills the advance of the glyph over the height of a line
+void _drawGfxChar(int16_t x, int16_t y, uint8_t letter, Color color, Color bg_color, uint8_t size)
+{
+    const GFXglyph *glyph = getGlyph(gfx_font, letter);
+    if (glyph == 0)
+    {
+        return;
+    }
+    if (bg_color.invalid_bits == 0)
+    {
+        _fillSpanRows(x, x + pgm_read_byte(&glyph->xAdvance) * size - 1, y, (uint16_t)pgm_read_byte(&gfx_font->yAdvance) * size, bg_color);
+    }
+    const uint8_t *bitmap = (const uint8_t *)pgm_read_ptr(&gfx_font->bitmap) + pgm_read_word(&glyph->bitmapOffset);
+    const uint8_t width = pgm_read_byte(&glyph->width);
+    const uint8_t height = pgm_read_byte(&glyph->height);
+    const int16_t left = x + (int8_t)pgm_read_byte(&glyph->xOffset) * size;
+    int16_t top = y + (gfx_ascent + (int8_t)pgm_read_byte(&glyph->yOffset)) * size;
+    // glyphs outside the text clip are not unpacked
+    if (left > text_clip_x1 || left + width * size <= text_clip_x0 || top > text_clip_y1 || top + height * size <= text_clip_y0)
+    {
+        return;
+    }
+    // the bits run on over row ends
+    uint8_t bits = 0, bit_count = 0;
+    for (uint8_t row = 0; row < height; row++, top += size)
     {
-        uint8_t current_line = getFontLine(letter, i);
-        // iterate through the character bit by bit
-        for (uint8_t j = 0; j < PANEL_FONT_X; j++)
+        uint8_t run = 0xFF;
+        for (uint8_t column = 0; column < width; column++)
         {
-            // shift by j and check for bit set
-            if (current_line & (uint8_t)(1 << (uint8_t)(PANEL_FONT_X - j)))
+            if (bit_count == 0)
             {
-                // set pixel at i and j
-                setBuffer(x + j, y + i, color);
+                bits = pgm_read_byte(bitmap++);
+                bit_count = 8;
             }
-            else if (bg_color.invalid_bits == 0)
+            const bool set = bits & 0x80;
+            bits <<= 1;
+            bit_count--;
+            if (set && run == 0xFF)
             {
-                setBuffer(x + j, y + i, bg_color);
+                run = column;
+            }
+            else if (!set && run != 0xFF)
+            {
+                _fillSpanRows(left + run * size, left + column * size - 1, top, size, color);
+                run = 0xFF;
             }
         }
+        if (run != 0xFF)
+        {
+            _fillSpanRows(left + run * size, left + width * size - 1, top, size, color);
+        }
     }
 }
+#endif
+
+// the columns of a fixed font line as a mask, bit j for column j, getFontLine has column j in bit PANEL_FONT_X - j
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline uint8_t
+_fontPixels(uint8_t line)
+{
+    uint8_t pixels = 0;
+    for (uint8_t j = 0; j < PANEL_FONT_X; j++)
+    {
+        pixels |= ((line >> (PANEL_FONT_X - j)) & 1) << j;
+    }
+    return pixels;
+}
+
+// the columns of width columns from x on that are inside the text clip, bit j for column j
+uint8_t _clipColumns(int16_t x, uint8_t width)
+{
+    uint8_t visible = (1 << width) - 1;
+    if (x + width <= text_clip_x0 || x > text_clip_x1)
+    {
+        return 0;
+    }
+    if (x < text_clip_x0)
+    {
+        visible &= visible << (text_clip_x0 - x);
+    }
+    if (x + width - 1 > text_clip_x1)
+    {
+        visible &= (1 << (text_clip_x1 - x + 1)) - 1;
+    }
+    return visible;
+}
+
+// the runs of set bits in pixels, every column size pixels wide and high
+void _fillRuns(int16_t x, int16_t y, uint8_t pixels, uint8_t size, Color color)
+{
+    for (uint8_t j = 0; pixels != 0;)
+    {
+        if (!(pixels & 1))
+        {
+            pixels >>= 1;
+            j++;
+            continue;
+        }
+        uint8_t end = j;
+        while (pixels & 1)
+        {
+            pixels >>= 1;
+            end++;
+        }
+        _fillSpanRows(x + j * size, x + end * size - 1, y, size, color);
+        j = end;
+    }
+}
+
+// how far drawString moves on after letter
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline uint8_t
+charWidth(char letter)
+{
+#if PANEL_FONT == 2
+    if (gfx_font != 0)
+    {
+        const GFXglyph *glyph = getGlyph(gfx_font, letter);
+        return glyph == 0 ? 0 : pgm_read_byte(&glyph->xAdvance);
+    }
+#else
+    (void)letter;
+#endif
+    return PANEL_FONT_X;
+}
+
+// the distance between two lines of text
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline uint8_t
+fontHeight()
+{
+#if PANEL_FONT == 2
+    if (gfx_font != 0)
+    {
+        return pgm_read_byte(&gfx_font->yAdvance);
+    }
+#endif
+    return PANEL_FONT_Y + 1;
+}
+
+// how far drawBigString moves on after letter, the fixed fonts keep 1 column between size times larger glyphs
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline uint8_t
+_charAdvance(char letter, uint8_t size)
+{
+#if PANEL_FONT == 2
+    if (gfx_font != 0)
+    {
+        return charWidth(letter) * size;
+    }
+#else
+    (void)letter;
+#endif
+    return size == 1 ? PANEL_FONT_X : (PANEL_FONT_X - 1) * size + 1;
+}
+
+// the distance between two lines of size times larger text
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline uint8_t
+_lineAdvance(uint8_t size)
+{
+#if PANEL_FONT == 2
+    if (gfx_font != 0)
+    {
+        return fontHeight() * size;
+    }
+#endif
+    return size == 1 ? PANEL_FONT_Y + 1 : PANEL_FONT_Y * size + 1;
+}
 
 #ifdef PANEL_MAX_SPEED
 __attribute__((always_inline))
 #endif
 inline void
-drawBigChar(uint8_t x, uint8_t y, char letter, Color color, uint8_t size_modifier)
+drawChar(int16_t x, int16_t y, char letter, Color color)
+{
+    drawChar(x, y, letter, color, Colors::NO_COLOR);
+}
+
+void drawChar(int16_t x, int16_t y, char letter, Color color, const Color bg_color)
+{
+#if PANEL_FONT == 2
+    if (gfx_font != 0)
+    {
+        _drawGfxChar(x, y, letter, color, bg_color, 1);
+        return;
+    }
+#endif
+    // every line as one masked write per LED struct it touches, the background as a second one
+    // only the columns and lines inside the text clip are read and written
+    const uint8_t visible = _clipColumns(x, PANEL_FONT_X);
+    if (visible == 0)
+    {
+        return;
+    }
+    for (uint8_t i = 0; i < PANEL_FONT_Y; i++)
+    {
+        if (y + i < text_clip_y0 || y + i > text_clip_y1)
+        {
+            continue;
+        }
+        const uint8_t pixels = _fontPixels(getFontLine(letter, i));
+        setMasked(x, y + i, pixels & visible, color);
+        if (bg_color.invalid_bits == 0)
+        {
+            setMasked(x, y + i, (uint8_t)~pixels & visible, bg_color);
+        }
+    }
+}
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+drawBigChar(int16_t x, int16_t y, char letter, Color color, uint8_t size_modifier)
 {
     if (size_modifier == 1)
     {
@@ -52,31 +331,33 @@ drawBigChar(uint8_t x, uint8_t y, char letter, Color color, uint8_t size_modifie
     drawBigChar(x, y, letter, color, Colors::NO_COLOR, size_modifier);
 }
 
-void drawBigChar(uint8_t x, uint8_t y, char letter, Color color, Color bg_color, uint8_t size_modifier)
-{ // new with scaling, but may be slower
+void drawBigChar(int16_t x, int16_t y, char letter, Color color, Color bg_color, uint8_t size_modifier)
+{ // scaled by repeating the runs of every line
     if (size_modifier == 1)
     {
         drawChar(x, y, letter, color, bg_color);
         return;
     }
+#if PANEL_FONT == 2
+    if (gfx_font != 0)
+    {
+        _drawGfxChar(x, y, letter, color, bg_color, size_modifier);
+        return;
+    }
+#endif
 
-    // iterate through the character line by line
+    if (x + PANEL_FONT_X * size_modifier <= text_clip_x0 || x > text_clip_x1 || y + PANEL_FONT_Y * size_modifier <= text_clip_y0 || y > text_clip_y1)
+    {
+        return;
+    }
+    // every run of a line becomes one span, repeated for the size_modifier rows the line is high
     for (uint8_t i = 0; i < PANEL_FONT_Y; i++)
     {
-        uint8_t current_line = getFontLine(letter, i);
-        // iterate through the character bit by bit, so x direction
-        for (uint8_t j = 0; j < PANEL_FONT_X; j++)
+        const uint8_t pixels = _fontPixels(getFontLine(letter, i));
+        _fillRuns(x, y + i * size_modifier, pixels, size_modifier, color);
+        if (bg_color.invalid_bits == 0)
         {
-            // shift by j and check for bit set
-            if (current_line & (uint8_t)(1 << (uint8_t)(PANEL_FONT_X - j)))
-            {
-                // set pixel at i and j
-                drawSquare(x + j * size_modifier, y + i * size_modifier, size_modifier, color, true);
-            }
-            else if (bg_color.invalid_bits == 0)
-            {
-                drawSquare(x + j * size_modifier, y + i * size_modifier, size_modifier, bg_color, true);
-            }
+            _fillRuns(x, y + i * size_modifier, (uint8_t)~pixels & (uint8_t)((1 << PANEL_FONT_X) - 1), size_modifier, bg_color);
         }
     }
 }
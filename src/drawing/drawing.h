@@ -1,6 +1,7 @@
 #ifndef HUB75NANO_DRAWING_H
 #define HUB75NANO_DRAWING_H
 
+#include "bitmap.h"
 #include "char.h"
 #include "circle.h"
 #include "ellipse.h"
@@ -8,6 +9,7 @@
 #include "rectangle.h"
 #include "thickLine.h"
 #include "string.h"
+#include "text.h"
 #include "triangle.h"
 
 #endif // HUB75NANO_DRAWING_H
\ No newline at end of file
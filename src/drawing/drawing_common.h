@@ -1,7 +1,11 @@
 #ifndef HUB75NANO_DRAWING_COMMON_H
 #define HUB75NANO_DRAWING_COMMON_H
 
+#ifdef PANEL_HOST
+#include "../boards/host/host_arduino.h"
+#else
 #include <Arduino.h>
+#endif
 #include "../structs/Color.h"
 #include "../structs/Colors.h"
 #include "../buffer_setting/buffer.h"
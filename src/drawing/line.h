@@ -53,32 +53,7 @@ void drawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, Color color)
             x1 = a;
         }
 
-        if (x2 >= PANEL_X)
-        {
-            x2 = PANEL_X - 1;
-        }
-
-        //  short horizontal lines
-        while ((x1 & 3) != 0 && x1 < x2)
-        {
-            setBuffer(x1, y1, color);
-            x1++;
-        }
-
-        // lines always appear one short
-        x2++;
-        while ((x2 & 3) != 0 && x2 > x1)
-        {
-            x2--;
-            setBuffer(x2, y1, color);
-        }
-
-        // blocks of horizontal lines
-        if (x2 - x1 >= 4 && !OVERFLOW)
-        {
-            uint8_t block_count = ((x2 - x1) / 4);
-            _setBuffer4xBlockWise(x1, y1, block_count, color);
-        }
+        setSpan(x1, x2, y1, color);
         return;
     }
 
@@ -38,114 +38,26 @@ void drawRectHollow(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, Color color)
         setBuffer(x2, j, color);
     }
 
-    x1++;
-    //  guard against rects being 1 high
-    if (y1 == y2)
+    // the corners are already set by the vertical lines, nothing lies between them if x2 is not at least 2 right of x1
+    // (x2 - 1 and x1 + 1 would wrap around in the uint8_t of setSpan for x2 == 0 or x1 == 255)
+    if (x2 <= x1 + 1)
     {
-        // short horizontal lines
-        while ((x1 & 3) != 0 && x1 < x2)
-        {
-            setBuffer(x1, y1, color);
-            x1++;
-        }
-
-        while ((x2 & 3) != 0 && x2 > x1)
-        {
-            x2--;
-            setBuffer(x2, y1, color);
-        }
-
-        // blocks of horizontal lines
-        if (x2 - x1 >= 4 && !OVERFLOW)
-        {
-            uint8_t block_count = ((x2 - x1) / 4);
-            _setBuffer4xBlockWise(x1, y1, block_count, color);
-        }
+        return;
     }
-    else
+    setSpan(x1 + 1, x2 - 1, y1, color);
+    //  guard against rects being 1 high
+    if (y1 != y2)
     {
-        // short horizontal lines
-        while ((x1 & 3) != 0 && x1 < x2)
-        {
-            setBuffer(x1, y1, color);
-            setBuffer(x1, y2, color);
-            x1++;
-        }
-
-        while ((x2 & 3) != 0 && x2 > x1)
-        {
-            x2--;
-            setBuffer(x2, y1, color);
-            setBuffer(x2, y2, color);
-        }
-
-        // blocks of horizontal lines
-        if (x2 - x1 >= 4 && !OVERFLOW)
-        {
-            uint8_t block_count = ((x2 - x1) / 4);
-
-            _setBuffer4xBlockWise(x1, y1, block_count, color);
-            _setBuffer4xBlockWise(x1, y2, block_count, color);
-        }
+        setSpan(x1 + 1, x2 - 1, y2, color);
     }
 }
 
 void fillRect(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, Color color)
 {
-    if (x1 == x2) // 1 wide ones
-    {
-        for (uint8_t j = y1; j <= y2; j++)
-        {
-            setBuffer(x1, j, color);
-        }
-        return;
-    }
-    else if (x2 - x1 == 1) // 2 wide
-    {
-        for (uint8_t j = y1; j <= y2; j++)
-        {
-            setBuffer(x1, j, color);
-            setBuffer(x1 + 1, j, color);
-        }
-        return;
-    }
-    else if (x2 - x1 == 2) // 3 wide
-    {
-        for (uint8_t j = y1; j <= y2; j++)
-        {
-            setBuffer(x1, j, color);
-            setBuffer(x1 + 1, j, color);
-            setBuffer(x1 + 2, j, color);
-        }
-        return;
-    }
-
-    // go through each horizontal line and fill (try for blocks of 4 led)
-    uint8_t original_x1 = x1, original_x2 = x2 + 1;
-
+    // go through each horizontal line and fill
     for (uint8_t j = y1; j <= y2; j++)
-    { // horizontal lines
-        x1 = original_x1;
-        x2 = original_x2;
-        while ((x1 & 3) != 0 && x1 < x2)
-        {
-            setBuffer(x1, j, color);
-            x1++;
-        }
-
-        while ((x2 & 3) != 0 && x2 > x1)
-        {
-            x2--;
-            setBuffer(x2, j, color);
-        }
-
-        // check against overflow
-        if (x2 - x1 >= 4 && !OVERFLOW)
-        {
-            uint8_t block_count = ((x2 - x1) / 4);
-
-            _setBuffer4xBlockWise(x1, j, block_count, color);
-        }
+    {
+        setSpan(x1, x2, j, color);
     }
 }
 
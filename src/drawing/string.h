@@ -5,11 +5,22 @@
 #include "drawing_common.h"
 #include "char.h"
 
+// the first length characters of str (or up to its end) size times larger, stops at the right edge of the text clip
+void _drawString(int16_t x, int16_t y, const char *str, uint16_t length, Color color, Color bg_color, uint8_t size)
+{
+    for (; length > 0 && *str != 0 && x <= text_clip_x1; str++, length--)
+    {
+        // glyphs left of the clip return before reading the font
+        drawBigChar(x, y, *str, color, bg_color, size);
+        x += _charAdvance(*str, size);
+    }
+}
+
 #ifdef PANEL_MAX_SPEED
 __attribute__((always_inline))
 #endif
 inline void
-drawString(uint8_t x, uint8_t y, char *str, Color color)
+drawString(int16_t x, int16_t y, const char *str, Color color)
 
 {
     drawString(x, y, str, color, Colors::NO_COLOR);
@@ -19,41 +30,28 @@ drawString(uint8_t x, uint8_t y, char *str, Color color)
 __attribute__((always_inline))
 #endif
 inline void
-drawBigString(uint8_t x, uint8_t y, char *str, Color color, uint8_t size_modifier)
+drawBigString(int16_t x, int16_t y, const char *str, Color color, uint8_t size_modifier)
 {
     drawBigString(x, y, str, color, Colors::NO_COLOR, size_modifier);
 }
 
-void drawBigString(uint8_t x, uint8_t y, char *str, Color color, Color bg_color, uint8_t size_modifier)
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+drawBigString(int16_t x, int16_t y, const char *str, Color color, Color bg_color, uint8_t size_modifier)
 {
-    if (size_modifier == 1)
-    {
-        drawString(x, y, str, color, bg_color);
-        return;
-    }
-    for (uint8_t i = 0; i < strlen(str); i++)
-    {
-        uint8_t xoffset = x + (3 * size_modifier + 1) * i;
-        if (xoffset > PANEL_X)
-            return;
-
-        drawBigChar(xoffset, y, str[i], color, bg_color, size_modifier); // seperate by 1
-        // drawBigChar(x + 4 * size_modifier * i, y, str[i], color, size_modifier); //seperate by size
-    }
+    _drawString(x, y, str, 0xFFFF, color, bg_color, size_modifier);
 }
 
-void drawString(uint8_t x, uint8_t y, char *str, Color color, Color bg_color)
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+drawString(int16_t x, int16_t y, const char *str, Color color, Color bg_color)
 {
-    for (uint8_t i = 0; i < strlen(str); i++)
-    {
-        uint8_t xoffset = x + 4 * i;
-        if (xoffset > PANEL_X)
-            return;
-
-        drawChar(xoffset, y, str[i], color, bg_color); // seperate by 1
-        // drawBigChar(x + 4 * size_modifier * i, y, str[i], color, size_modifier); //seperate by size
-    }
+    _drawString(x, y, str, 0xFFFF, color, bg_color, 1);
 }
 
 #endif
-#endif // HUB75NANO_STRING_H
\ No newline at end of file
+#endif // HUB75NANO_STRING_H
@@ -0,0 +1,164 @@
+#ifndef HUB75NANO_TEXT_H
+#define HUB75NANO_TEXT_H
+#ifndef PANEL_NO_FONT
+
+#include "drawing_common.h"
+#include "char.h"
+#include "string.h"
+
+// where drawAlignedString puts x and drawText puts every line in its box
+#define TEXT_LEFT 0
+#define TEXT_CENTER 1
+#define TEXT_RIGHT 2
+
+// how far drawBigString moves on over the first length characters of str (or up to its end)
+uint16_t measureString(const char *str, uint8_t size, uint16_t length)
+{
+    uint16_t width = 0;
+    for (; length > 0 && *str != 0; str++, length--)
+    {
+        width += _charAdvance(*str, size);
+    }
+    return width;
+}
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline uint16_t
+measureString(const char *str, uint8_t size)
+{
+    return measureString(str, size, 0xFFFF);
+}
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline uint16_t
+measureString(const char *str)
+{
+    return measureString(str, 1, 0xFFFF);
+}
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+drawAlignedString(int16_t x, int16_t y, const char *str, uint8_t align, Color color)
+{
+    drawAlignedString(x, y, str, align, color, Colors::NO_COLOR, 1, measureString(str));
+}
+
+// str with its left end (TEXT_LEFT), its middle (TEXT_CENTER) or its right end (TEXT_RIGHT) at x
+// width is measureString(str, size), a sketch that draws the same text every frame measures it once and keeps it
+void drawAlignedString(int16_t x, int16_t y, const char *str, uint8_t align, Color color, Color bg_color, uint8_t size, uint16_t width)
+{
+    if (align == TEXT_CENTER)
+    {
+        x -= width / 2;
+    }
+    else if (align == TEXT_RIGHT)
+    {
+        x -= width - 1;
+    }
+    _drawString(x, y, str, 0xFFFF, color, bg_color, size);
+}
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline uint16_t
+drawText(int16_t x1, int16_t y1, int16_t x2, int16_t y2, const char *str, uint8_t align, Color color)
+{
+    return drawText(x1, y1, x2, y2, str, align, color, Colors::NO_COLOR, 1);
+}
+
+// str wrapped into the box from x1, y1 to x2, y2 (both included) at spaces and '\n', words wider than the box are cut
+// every line is aligned in the box and nothing is drawn outside of it, bg_color fills the whole box first
+// returns how many characters of str are on lines that fit completely, str + that is where the next page starts
+uint16_t drawText(int16_t x1, int16_t y1, int16_t x2, int16_t y2, const char *str, uint8_t align, Color color, Color bg_color, uint8_t size)
+{
+    if (x2 < x1 || y2 < y1)
+    {
+        return 0;
+    }
+    // the box is the clip while the lines are drawn, inside the clip that was set before
+    const int16_t clip_x0 = text_clip_x0, clip_y0 = text_clip_y0, clip_x1 = text_clip_x1, clip_y1 = text_clip_y1;
+    setTextClip(max(x1, clip_x0), max(y1, clip_y0), min(x2, clip_x1), min(y2, clip_y1));
+    if (bg_color.invalid_bits == 0)
+    {
+        _fillSpanRows(x1, x2, y1, y2 - y1 + 1, bg_color);
+    }
+    const uint16_t box_width = x2 - x1 + 1;
+    const uint8_t line_height = _lineAdvance(size);
+    const char *line = str;
+    const char *shown = str;
+    for (int16_t y = y1; *line != 0 && y <= y2; y += line_height)
+    {
+        // the most whole words that fit, every line is measured once while it is broken
+        uint16_t length = 0, width = 0;
+        uint16_t fit_length = 0xFFFF, fit_width = 0;
+        for (;;)
+        {
+            const char letter = line[length];
+            if (letter == 0 || letter == '\n')
+            {
+                fit_length = length;
+                fit_width = width;
+                break;
+            }
+            if (letter == ' ')
+            {
+                fit_length = length;
+                fit_width = width;
+            }
+            const uint8_t advance = _charAdvance(letter, size);
+            if (width + advance > box_width && letter != ' ')
+            {
+                if (fit_length == 0xFFFF)
+                {
+                    // a word wider than the box, cut after the last character that fits but take at least one
+                    fit_length = length == 0 ? 1 : length;
+                    fit_width = length == 0 ? advance : width;
+                }
+                break;
+            }
+            width += advance;
+            length++;
+        }
+
+        int16_t x = x1;
+        if (align == TEXT_CENTER)
+        {
+            x += ((int16_t)box_width - (int16_t)fit_width) / 2;
+        }
+        else if (align == TEXT_RIGHT)
+        {
+            x += (int16_t)box_width - (int16_t)fit_width;
+        }
+        _drawString(x, y, line, fit_length, color, Colors::NO_COLOR, size);
+
+        line += fit_length;
+        // the line break is dropped, and so are the spaces a wrapped line ended at
+        if (*line == '\n')
+        {
+            line++;
+        }
+        else
+        {
+            while (*line == ' ')
+            {
+                line++;
+            }
+        }
+        if (y + line_height - 1 <= y2)
+        {
+            shown = line;
+        }
+    }
+    setTextClip(clip_x0, clip_y0, clip_x1, clip_y1);
+    return shown - str;
+}
+
+#endif
+#endif // HUB75NANO_TEXT_H
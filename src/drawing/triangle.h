@@ -83,6 +83,17 @@ void fillTriangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t x3, ui
         y2 = temp;
     }
 
+    // the edge functions below are positive inside for one winding only, the ordering above does not settle it
+    if ((int16_t)(x2 - x1) * (y3 - y1) - (int16_t)(y2 - y1) * (x3 - x1) < 0)
+    {
+        uint8_t temp = x3;
+        x3 = x2;
+        x2 = temp;
+        temp = y3;
+        y3 = y2;
+        y2 = temp;
+    }
+
     // fill outline
     drawLine(x1, y1, x2, y2, color);
     drawLine(x1, y1, x3, y3, color);
@@ -126,20 +137,25 @@ void fillTriangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t x3, ui
             // pixel is inside the edges
             if (w0_col >= 0 && w1_col >= 0 && w2_col >= 0)
             {
-                // save first and last pixel on this line that are in the triangle
+                // the first pixel on this line that is in the triangle, the run is set as one span when it ends
                 if (firstX == 0)
                 {
-                    setBuffer(x, y, color);
                     firstX = x;
                 }
             }
             else if (firstX != 0)
             {
                 // line drawn, skip rest of pixels in this line
-                drawLine(firstX, y, x, y, color);
-                x = 0xfe;
+                setSpan(firstX, x - 1, y, color);
+                firstX = 0;
+                break;
             }
         }
+        // the run went on to the right edge of the bounding box
+        if (firstX != 0)
+        {
+            setSpan(firstX, x_max, y, color);
+        }
         w0_row += delta_w0_row;
         w1_row += delta_w1_row;
         w2_row += delta_w2_row;
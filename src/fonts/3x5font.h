@@ -1,7 +1,11 @@
 #ifndef HUB75NANO_3X5FONT_H
 #define HUB75NANO_3x5FONT_H
 
+#ifdef PANEL_HOST
+#include "../boards/host/host_arduino.h"
+#else
 #include "Arduino.h"
+#endif
 
 #pragma region font
 #ifndef PANEL_NO_FONT
@@ -0,0 +1,117 @@
+#ifndef HUB75NANO_4X6TILES_H
+#define HUB75NANO_4X6TILES_H
+
+#ifdef PANEL_HOST
+#include "../boards/host/host_arduino.h"
+#else
+#include "Arduino.h"
+#endif
+
+#pragma region tiles
+#ifdef PANEL_TEXT_MODE
+
+// the 3x5 font (3x5font.h) as the default tileset of the text mode, one byte per row instead of getFontLine at runtime
+// 6 rows per tile, the leftmost pixel is bit 3 and always empty like the spacing pixel of drawChar, descenders already moved down
+const uint8_t tiles4x6[96][6] PROGMEM = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*SPACE*/
+    {0x02, 0x02, 0x02, 0x00, 0x02, 0x00}, /*'!'*/
+    {0x05, 0x05, 0x00, 0x00, 0x00, 0x00}, /*'"'*/
+    {0x05, 0x07, 0x05, 0x07, 0x05, 0x00}, /*'#'*/
+    {0x03, 0x06, 0x07, 0x03, 0x06, 0x00}, /*'$'*/
+    {0x05, 0x01, 0x02, 0x04, 0x05, 0x00}, /*'%'*/
+    {0x02, 0x05, 0x02, 0x05, 0x06, 0x00}, /*'&'*/
+    {0x02, 0x02, 0x00, 0x00, 0x00, 0x00}, /*'''*/
+    {0x01, 0x02, 0x02, 0x02, 0x01, 0x00}, /*'('*/
+    {0x02, 0x01, 0x01, 0x01, 0x02, 0x00}, /*')'*/
+    {0x00, 0x05, 0x02, 0x05, 0x00, 0x00}, /*'*'*/
+    {0x00, 0x02, 0x07, 0x02, 0x00, 0x00}, /*'+'*/
+    {0x00, 0x00, 0x00, 0x02, 0x04, 0x00}, /*','*/
+    {0x00, 0x00, 0x07, 0x00, 0x00, 0x00}, /*'-'*/
+    {0x00, 0x00, 0x00, 0x00, 0x02, 0x00}, /*'.'*/
+    {0x01, 0x01, 0x02, 0x04, 0x04, 0x00}, /*'/'*/
+    {0x03, 0x05, 0x05, 0x05, 0x06, 0x00}, /*'0'*/
+    {0x02, 0x06, 0x02, 0x02, 0x07, 0x00}, /*'1'*/
+    {0x06, 0x01, 0x03, 0x04, 0x07, 0x00}, /*'2'*/
+    {0x06, 0x01, 0x02, 0x01, 0x06, 0x00}, /*'3'*/
+    {0x04, 0x04, 0x05, 0x07, 0x01, 0x00}, /*'4'*/
+    {0x07, 0x04, 0x07, 0x01, 0x06, 0x00}, /*'5'*/
+    {0x03, 0x04, 0x07, 0x05, 0x06, 0x00}, /*'6'*/
+    {0x07, 0x01, 0x02, 0x04, 0x04, 0x00}, /*'7'*/
+    {0x03, 0x05, 0x07, 0x05, 0x06, 0x00}, /*'8'*/
+    {0x03, 0x05, 0x07, 0x01, 0x06, 0x00}, /*'9'*/
+    {0x00, 0x02, 0x00, 0x02, 0x00, 0x00}, /*':'*/
+    {0x00, 0x02, 0x00, 0x02, 0x04, 0x00}, /*';'*/
+    {0x01, 0x02, 0x04, 0x02, 0x01, 0x00}, /*'<'*/
+    {0x00, 0x07, 0x00, 0x07, 0x00, 0x00}, /*'='*/
+    {0x04, 0x02, 0x01, 0x02, 0x04, 0x00}, /*'>'*/
+    {0x07, 0x01, 0x02, 0x00, 0x02, 0x00}, /*'?'*/
+    {0x02, 0x05, 0x05, 0x04, 0x03, 0x00}, /*'@'*/
+    {0x03, 0x05, 0x07, 0x05, 0x05, 0x00}, /*'A'*/
+    {0x03, 0x05, 0x06, 0x05, 0x06, 0x00}, /*'B'*/
+    {0x03, 0x04, 0x04, 0x04, 0x03, 0x00}, /*'C'*/
+    {0x06, 0x05, 0x05, 0x05, 0x06, 0x00}, /*'D'*/
+    {0x03, 0x04, 0x07, 0x04, 0x07, 0x00}, /*'E'*/
+    {0x03, 0x04, 0x07, 0x04, 0x04, 0x00}, /*'F'*/
+    {0x03, 0x04, 0x05, 0x05, 0x03, 0x00}, /*'G'*/
+    {0x05, 0x05, 0x07, 0x05, 0x05, 0x00}, /*'H'*/
+    {0x07, 0x02, 0x02, 0x02, 0x07, 0x00}, /*'I'*/
+    {0x03, 0x01, 0x01, 0x05, 0x02, 0x00}, /*'J'*/
+    {0x05, 0x05, 0x06, 0x05, 0x05, 0x00}, /*'K'*/
+    {0x04, 0x04, 0x04, 0x04, 0x07, 0x00}, /*'L'*/
+    {0x05, 0x07, 0x05, 0x05, 0x05, 0x00}, /*'M'*/
+    {0x06, 0x05, 0x05, 0x05, 0x05, 0x00}, /*'N'*/
+    {0x02, 0x05, 0x05, 0x05, 0x02, 0x00}, /*'O'*/
+    {0x06, 0x05, 0x07, 0x04, 0x04, 0x00}, /*'P'*/
+    {0x03, 0x05, 0x05, 0x07, 0x03, 0x00}, /*'Q'*/
+    {0x03, 0x05, 0x06, 0x05, 0x05, 0x00}, /*'R'*/
+    {0x03, 0x04, 0x02, 0x01, 0x06, 0x00}, /*'S'*/
+    {0x07, 0x02, 0x02, 0x02, 0x02, 0x00}, /*'T'*/
+    {0x05, 0x05, 0x05, 0x05, 0x03, 0x00}, /*'U'*/
+    {0x05, 0x05, 0x05, 0x05, 0x02, 0x00}, /*'V'*/
+    {0x05, 0x05, 0x05, 0x07, 0x05, 0x00}, /*'W'*/
+    {0x05, 0x05, 0x02, 0x05, 0x05, 0x00}, /*'X'*/
+    {0x05, 0x05, 0x02, 0x02, 0x02, 0x00}, /*'Y'*/
+    {0x07, 0x01, 0x02, 0x04, 0x07, 0x00}, /*'Z'*/
+    {0x03, 0x02, 0x02, 0x02, 0x03, 0x00}, /*'['*/
+    {0x04, 0x04, 0x02, 0x01, 0x01, 0x00}, /*'\'*/
+    {0x03, 0x01, 0x01, 0x01, 0x03, 0x00}, /*']'*/
+    {0x02, 0x05, 0x00, 0x00, 0x00, 0x00}, /*'^'*/
+    {0x00, 0x00, 0x00, 0x00, 0x07, 0x00}, /*'_'*/
+    {0x02, 0x01, 0x00, 0x00, 0x00, 0x00}, /*'`'*/
+    {0x00, 0x03, 0x05, 0x05, 0x03, 0x00}, /*'a'*/
+    {0x04, 0x06, 0x05, 0x05, 0x06, 0x00}, /*'b'*/
+    {0x00, 0x03, 0x04, 0x04, 0x03, 0x00}, /*'c'*/
+    {0x01, 0x03, 0x05, 0x05, 0x03, 0x00}, /*'d'*/
+    {0x00, 0x03, 0x05, 0x06, 0x03, 0x00}, /*'e'*/
+    {0x02, 0x05, 0x04, 0x06, 0x04, 0x00}, /*'f'*/
+    {0x00, 0x02, 0x05, 0x03, 0x01, 0x06}, /*'g'*/
+    {0x04, 0x04, 0x06, 0x05, 0x05, 0x00}, /*'h'*/
+    {0x02, 0x00, 0x02, 0x02, 0x01, 0x00}, /*'i'*/
+    {0x00, 0x02, 0x00, 0x02, 0x02, 0x04}, /*'j'*/
+    {0x04, 0x05, 0x06, 0x05, 0x05, 0x00}, /*'k'*/
+    {0x02, 0x02, 0x02, 0x02, 0x01, 0x00}, /*'l'*/
+    {0x00, 0x05, 0x07, 0x05, 0x05, 0x00}, /*'m'*/
+    {0x00, 0x06, 0x05, 0x05, 0x05, 0x00}, /*'n'*/
+    {0x00, 0x02, 0x05, 0x05, 0x02, 0x00}, /*'o'*/
+    {0x00, 0x06, 0x05, 0x05, 0x06, 0x04}, /*'p'*/
+    {0x00, 0x03, 0x05, 0x05, 0x03, 0x01}, /*'q'*/
+    {0x00, 0x05, 0x06, 0x04, 0x04, 0x00}, /*'r'*/
+    {0x00, 0x03, 0x06, 0x01, 0x06, 0x00}, /*'s'*/
+    {0x04, 0x06, 0x04, 0x04, 0x03, 0x00}, /*'t'*/
+    {0x00, 0x05, 0x05, 0x05, 0x03, 0x00}, /*'u'*/
+    {0x00, 0x05, 0x05, 0x05, 0x06, 0x00}, /*'v'*/
+    {0x00, 0x05, 0x05, 0x07, 0x05, 0x00}, /*'w'*/
+    {0x00, 0x05, 0x02, 0x05, 0x05, 0x00}, /*'x'*/
+    {0x00, 0x05, 0x05, 0x03, 0x01, 0x02}, /*'y'*/
+    {0x00, 0x07, 0x01, 0x02, 0x07, 0x00}, /*'z'*/
+    {0x03, 0x02, 0x06, 0x02, 0x03, 0x00}, /*'{'*/
+    {0x02, 0x02, 0x02, 0x02, 0x02, 0x00}, /*'|'*/
+    {0x06, 0x02, 0x03, 0x02, 0x06, 0x00}, /*'}'*/
+    {0x02, 0x05, 0x00, 0x00, 0x00, 0x00}, /*'~'*/
+    {0x02, 0x05, 0x05, 0x07, 0x00, 0x00}  /*''*/
+};
+
+#endif
+#pragma endregion // tiles
+
+#endif // HUB75NANO_4X6TILES_H
@@ -1,28 +1,45 @@
 #ifndef HUB75NANO_ADAFRUIT_GFX_FONT_ADAPTER_H
 #define HUB75NANO_ADAFRUIT_GFX_FONT_ADAPTER_H
 
+#ifdef PANEL_HOST
+#include "../boards/host/host_arduino.h"
+#else
 #include "Arduino.h"
+#endif
 #include <Adafruit_GFX.h>
 #include <glcdfont.c>
 
-// todo think about if it makes sense how i split the font stuff??
+// glcdfont stores every glyph as 5 columns with the top line in bit 0, reading a line out of that takes 5 reads
+// so the compiler turns it into lines here, one byte per line with column j in bit 6 - j like drawChar reads it
+// only this table ends up in flash (1792 bytes instead of the 1280 of the columns), the columns are only read while compiling
+constexpr uint8_t _glcdLine(uint8_t letter, uint8_t line_num, uint8_t column = 0)
+{
+    return column == 5 ? 0 : (uint8_t)((((font[letter * 5 + column] >> line_num) & 1) << (6 - column)) | _glcdLine(letter, line_num, column + 1));
+}
+
+#define GLCD_LINES(letter) {_glcdLine(letter, 0), _glcdLine(letter, 1), _glcdLine(letter, 2), _glcdLine(letter, 3), _glcdLine(letter, 4), _glcdLine(letter, 5), _glcdLine(letter, 6)}
+#define GLCD_LINES_4(letter) GLCD_LINES(letter), GLCD_LINES(letter + 1), GLCD_LINES(letter + 2), GLCD_LINES(letter + 3)
+#define GLCD_LINES_16(letter) GLCD_LINES_4(letter), GLCD_LINES_4(letter + 4), GLCD_LINES_4(letter + 8), GLCD_LINES_4(letter + 12)
+#define GLCD_LINES_64(letter) GLCD_LINES_16(letter), GLCD_LINES_16(letter + 16), GLCD_LINES_16(letter + 32), GLCD_LINES_16(letter + 48)
+
+constexpr uint8_t glcd_lines[256][7] PROGMEM = {GLCD_LINES_64(0), GLCD_LINES_64(64), GLCD_LINES_64(128), GLCD_LINES_64(192)};
+
+#undef GLCD_LINES
+#undef GLCD_LINES_4
+#undef GLCD_LINES_16
+#undef GLCD_LINES_64
+
 #ifdef PANEL_MAX_SPEED
 __attribute__((always_inline))
 #endif
 inline uint8_t
 getFontLine(unsigned char data, int line_num)
 {
-    data++;
-    uint8_t line = 0;
-    for (uint8_t i = 0; i < 5; i++)
-    { // Char bitmap = 5 columns
-        line |= (((pgm_read_byte(&font[data * 5 + i]) >> line_num) & 1) << i);
-    }
-    return line;
+    return pgm_read_byte(&glcd_lines[data][line_num]);
 } //<=============================================================================
 
 // default adafruit font, cant change much here
 inline void setFont() {}
 inline void setFont(PGM_VOID_P fontArray) {}
 
-#endif // HUB75NANO_ADAFRUIT_GFX_FONT_ADAPTER_H
\ No newline at end of file
+#endif // HUB75NANO_ADAFRUIT_GFX_FONT_ADAPTER_H
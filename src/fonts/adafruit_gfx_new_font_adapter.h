@@ -1,55 +1,46 @@
 #ifndef HUB75NANO_ADAFRUIT_GFX_NEW_FONT_ADAPTER_H
 #define HUB75NANO_ADAFRUIT_GFX_NEW_FONT_ADAPTER_H
 
-#include "Arduino.h"
-#include <Adafruit_GFX.h>
+// proportional fonts in the GFXfont format of Adafruit_GFX (the headers in its Fonts folder or made with its fontconvert),
+// picked at runtime with panel.setFont(&font), the 3x5 font draws until then and after setFont()
+#include "3x5font.h"
 
-#ifdef PANEL_MAX_SPEED
-__attribute__((always_inline))
-#endif
-inline uint8_t
-getFontLine(unsigned char data, int line_num)
+// the types of Adafruit_GFX/gfxfont.h, with its guard so both headers can be included in any order
+#ifndef _GFXFONT_H_
+#define _GFXFONT_H_
+typedef struct
 {
-    const uint8_t index = (data - 32);
-    unsigned char pixel = 0;
-    if (pgm_read_byte(&font4x6[index][1]) & (uint8_t)1 == 1)
-        line_num -= 1;
-    if (line_num == 0)
-    {
-        pixel = (pgm_read_byte(&font4x6[index][0])) >> (uint8_t)4;
-    }
-    else if (line_num == 1)
-    {
-        pixel = (pgm_read_byte(&font4x6[index][0])) >> (uint8_t)1;
-    }
-    else if (line_num == 2)
-    {
-        // Split over 2 bytes
-        return (((pgm_read_byte(&font4x6[index][0])) & (uint8_t)0x03) << (uint8_t)2) | (((pgm_read_byte(&font4x6[index][1])) & (uint8_t)0x02));
-    }
-    else if (line_num == 3)
-    {
-        pixel = (pgm_read_byte(&font4x6[index][1])) >> (uint8_t)4;
-    }
-    else if (line_num == 4)
-    {
-        pixel = (pgm_read_byte(&font4x6[index][1])) >> (uint8_t)1;
-    }
-    return pixel & (uint8_t)0xE;
-} //<=============================================================================
+    uint16_t bitmapOffset; // first byte of the glyph in the bitmap of the font
+    uint8_t width;         // size of the glyph bitmap
+    uint8_t height;
+    uint8_t xAdvance;      // distance to the next glyph
+    int8_t xOffset;        // from the cursor to the upper left corner of the bitmap
+    int8_t yOffset;        // from the baseline to the upper left corner of the bitmap
+} GFXglyph;
 
-// default font
-inline void setFont()
+typedef struct
 {
-}
+    uint8_t *bitmap;  // the bits of all glyphs, msb first, rows are not padded to whole bytes
+    GFXglyph *glyph;  // one glyph per character from first to last
+    uint16_t first;
+    uint16_t last;
+    uint8_t yAdvance; // distance from one line to the next
+} GFXfont;
+#endif
 
-inline void setFont(PGM_VOID_P fontArray)
+// the glyph of letter in font, 0 if the font does not have it
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline const GFXglyph *
+getGlyph(const GFXfont *font, uint8_t letter)
 {
-    if (fontArray == 0)
+    const uint16_t first = pgm_read_word(&font->first);
+    if (letter < first || letter > pgm_read_word(&font->last))
     {
-        setFont();
-        return;
+        return 0;
     }
+    return (const GFXglyph *)pgm_read_ptr(&font->glyph) + (letter - first);
 }
 
-#endif // HUB75NANO_ADAFRUIT_GFX_NEW_FONT_ADAPTER_H
\ No newline at end of file
+#endif // HUB75NANO_ADAFRUIT_GFX_NEW_FONT_ADAPTER_H
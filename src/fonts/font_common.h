@@ -1,6 +1,8 @@
 #ifndef HUB75NANO_FONT_COMMON_H
 #define HUB75NANO_FONT_COMMON_H
+#ifndef PANEL_HOST
 #include <avr/pgmspace.h>
+#endif
 #include "../Settings.h"
 #ifndef PANEL_NO_FONT
 
@@ -19,11 +21,18 @@
 #else
 #if PANEL_FONT == 2
 #include "adafruit_gfx_new_font_adapter.h"
+#define PANEL_FONT_X 4 /* the 3x5 font that draws without a GFXfont, those bring their own sizes */
+#define PANEL_FONT_Y 5
 #else
 #error "no font chosen"
 #endif
 #endif
 #endif
 
+#endif
+
+// the text mode shifts its tiles out directly, independent of the drawing font
+#ifdef PANEL_TEXT_MODE
+#include "4x6tiles.h"
 #endif
 #endif // HUB75NANO_FONT_COMMON_H
\ No newline at end of file
@@ -3,28 +3,72 @@
 
 #include "../../buffer_setting/buffer_common.h"
 #include "../../Settings.h"
+#include "1bit_buffer_asm.h"
+
+// the streamed frames swap between two buffers
+#define SMALL_BUFFER_START PANEL_SHOWN_BUFFER
+
+#if PANEL_CANVAS_X > PANEL_X
+// the first view_shift pixels of the LED after the row, they push the pixels before the viewport out of the row again
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+_shiftSmallViewTail(const LED *index)
+{
+    if (view_shift > 0)
+    {
+        _set_color((*(uint8_t *)(index)) & 63);
+        Clock;
+    }
+    if (view_shift > 1)
+    {
+        _set_color((uint8_t)((*((uint16_t *)(index)) >> (uint8_t)6)) & 63);
+        Clock;
+    }
+    if (view_shift > 2)
+    {
+        _set_color((uint8_t)((*((uint16_t *)(((uint8_t *)(index) + sizeof(uint8_t))))) >> (uint8_t)4) & 63);
+        Clock;
+    }
+}
+#endif
 
 void _displaySmallBuffer()
 {
     LED *index;
     CLEAR_OE;
+    PANEL_STATS_OE_ON;
     for (uint8_t y = 0; y < PANEL_Y / 2; y++) // 16 rows
     {
+#ifdef PANEL_TEXT_MODE
+        // the previous row stays lit while this one is rendered from the cells
+        _renderTextRow(y);
+        index = (LED *)(&buffer);
+#else
+#if PANEL_CANVAS_X > PANEL_X
+        index = SMALL_BUFFER_START + _bufferRow(y) * (PANEL_CANVAS_X / 4) + view_led;
+#else
 #if PANEL_Y > 32
-        index = (LED *)(&buffer) + (y << (uint8_t)5);
+        index = SMALL_BUFFER_START + (_bufferRow(y) << (uint8_t)5);
 #else
 #if PANEL_Y > 16
-        index = (LED *)(&buffer) + (y << (uint8_t)4);
+        index = SMALL_BUFFER_START + (_bufferRow(y) << (uint8_t)4);
 #else
 #if PANEL_Y > 8
-        index = (LED *)(&buffer) + (y << (uint8_t)3);
+        index = SMALL_BUFFER_START + (_bufferRow(y) << (uint8_t)3);
 #else
 #if PANEL_Y > 4
-        index = (LED *)(&buffer) + (y << (uint8_t)2);
+        index = SMALL_BUFFER_START + (_bufferRow(y) << (uint8_t)2);
+#endif
 #endif
 #endif
 #endif
 #endif
+#endif
+#ifdef PANEL_ASM_ROWS
+        _shiftSmallRowAsm(index);
+#else
         // we set each pixel after the other
 
         _set_color((*(uint8_t *)(index)) & 63);
@@ -179,13 +223,27 @@ void _displaySmallBuffer()
         Clock;
         _set_color(*((((uint8_t *)(index)) + (sizeof(uint8_t) * 2))) >> (uint8_t)2);
         Clock;
+#endif
+#endif
+#if PANEL_CANVAS_X > PANEL_X
+#ifdef PANEL_ASM_ROWS
+        _shiftSmallViewTail(index + PANEL_X / 4);
+#else
+        _shiftSmallViewTail(index + 1);
+#endif
 #endif
         // set _row
+        PANEL_STATS_OE_OFF;
         HIGH_OE;
         LATCH;
         _stepRow();
         CLEAR_OE;
+        PANEL_STATS_ROW;
+        PANEL_STATS_OE_ON;
+        // the row is lit while the serial input is taken in
+        PANEL_SERIAL_ROW;
     }
+    PANEL_STATS_OE_OFF;
     HIGH_OE;
 }
 
@@ -0,0 +1,131 @@
+#ifndef HUB75NANO_1BIT_BUFFER_ASM_H
+#define HUB75NANO_1BIT_BUFFER_ASM_H
+
+#include "../../buffer_setting/buffer_common.h"
+#include "../../Settings.h"
+
+// hand scheduled row shifter for the 1 bit buffer, so the timing no longer depends on the gcc version
+// only available on the atmega328(p) and atmega2560 with the default color and clock pins
+#ifdef PANEL_ASM_ROWS
+#if !defined(PANEL_ASM_COLOR_PORT) || !(defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || defined(__AVR_ATmega2560__))
+#pragma GCC warning "PANEL_ASM_ROWS needs an atmega328(p) or atmega2560 with the default color and clock pins, using the c row shifter"
+#undef PANEL_ASM_ROWS
+#endif
+#endif
+
+#ifdef PANEL_ASM_ROWS
+
+// cycles it takes to shift out one LED_short (4 pixels), independent of the content
+// atmega328(p): 3x ld (6) + 4 pixels * 3x out (12) + bit extraction (16) = 34 -> 8.5 per pixel
+// atmega2560: 3x ld (6) + 4 pixels * (sts + 2x out) (16) + bit extraction (19) = 41 -> 10.25 per pixel
+#if defined(__AVR_ATmega2560__)
+#define PANEL_ASM_CYCLES_PER_4_PIXELS 41
+#else
+#define PANEL_ASM_CYCLES_PER_4_PIXELS 34
+#endif
+#define PANEL_ASM_CYCLES_PER_ROW (PANEL_ASM_CYCLES_PER_4_PIXELS * (PANEL_X / 4))
+
+/*
+    shifts one row of the 1 bit buffer out, CLK has to be low when called
+    layout of one LED_short, u/l is upper/lower half, 0-3 the pixel:
+    byte 0: u1 u1 l0 l0 l0 u0 u0 u0 (rgb for each, msb first)
+    byte 1: l2 u2 u2 u2 l1 l1 l1 u1
+    byte 2: l3 l3 l3 u3 u3 u3 l2 l2
+*/
+__attribute__((always_inline)) inline void _shiftSmallRowAsm(const LED *index)
+{
+    const uint8_t *pixels = (const uint8_t *)index;
+    uint8_t first, second, third, color;
+    const uint8_t clock_mask = (uint8_t)(1 << PANEL_ASM_CLK_BIT);
+#if defined(__AVR_ATmega2560__)
+    __asm__ __volatile__(
+        ".rept %[groups]\n\t"
+        "ld %[first], %a[pixels]+\n\t"   // 2
+        "ld %[second], %a[pixels]+\n\t"  // 2
+        "ld %[third], %a[pixels]+\n\t"   // 2
+        // pixel 0: bits 0-5 of byte 0, shifted to PL2-PL7
+        "mov %[color], %[first]\n\t"     // 1
+        "lsl %[color]\n\t"               // 1
+        "lsl %[color]\n\t"               // 1
+        "sts %[port], %[color]\n\t"      // 2
+        "out %[clk], %[mask]\n\t"        // 1
+        "out %[clk], %[mask]\n\t"        // 1
+        // pixel 1: bits 6-7 of byte 0 and 0-3 of byte 1, rotated in through carry
+        "mov %[color], %[second]\n\t"    // 1
+        "lsl %[first]\n\t"               // 1
+        "rol %[color]\n\t"               // 1
+        "lsl %[first]\n\t"               // 1
+        "rol %[color]\n\t"               // 1
+        "lsl %[color]\n\t"               // 1
+        "lsl %[color]\n\t"               // 1
+        "sts %[port], %[color]\n\t"      // 2
+        "out %[clk], %[mask]\n\t"        // 1
+        "out %[clk], %[mask]\n\t"        // 1
+        // pixel 2: bits 4-7 of byte 1 and 0-1 of byte 2, nibble swapped
+        "swap %[second]\n\t"             // 1
+        "andi %[second], 0x0F\n\t"       // 1
+        "mov %[color], %[third]\n\t"     // 1
+        "swap %[color]\n\t"              // 1
+        "andi %[color], 0x30\n\t"        // 1
+        "or %[color], %[second]\n\t"     // 1
+        "lsl %[color]\n\t"               // 1
+        "lsl %[color]\n\t"               // 1
+        "sts %[port], %[color]\n\t"      // 2
+        "out %[clk], %[mask]\n\t"        // 1
+        "out %[clk], %[mask]\n\t"        // 1
+        // pixel 3: bits 2-7 of byte 2 are already in place
+        "andi %[third], 0xFC\n\t"        // 1
+        "sts %[port], %[third]\n\t"      // 2
+        "out %[clk], %[mask]\n\t"        // 1
+        "out %[clk], %[mask]\n\t"        // 1
+        ".endr\n\t"
+        : [pixels] "+x"(pixels), [first] "=&d"(first), [second] "=&d"(second), [third] "=&d"(third), [color] "=&d"(color)
+        : [groups] "n"(PANEL_X / 4), [port] "n"(_SFR_MEM_ADDR(PANEL_ASM_COLOR_PORT)), [clk] "I"(_SFR_IO_ADDR(PANEL_ASM_CLK_TOGGLE)), [mask] "r"(clock_mask)
+        : "memory");
+#else
+    __asm__ __volatile__(
+        ".rept %[groups]\n\t"
+        "ld %[first], %a[pixels]+\n\t"   // 2
+        "ld %[second], %a[pixels]+\n\t"  // 2
+        "ld %[third], %a[pixels]+\n\t"   // 2
+        // pixel 0: bits 0-5 of byte 0
+        "mov %[color], %[first]\n\t"     // 1
+        "andi %[color], 0x3F\n\t"        // 1
+        "out %[port], %[color]\n\t"      // 1
+        "out %[clk], %[mask]\n\t"        // 1
+        "out %[clk], %[mask]\n\t"        // 1
+        // pixel 1: bits 6-7 of byte 0 and 0-3 of byte 1, rotated in through carry
+        "mov %[color], %[second]\n\t"    // 1
+        "lsl %[first]\n\t"               // 1
+        "rol %[color]\n\t"               // 1
+        "lsl %[first]\n\t"               // 1
+        "rol %[color]\n\t"               // 1
+        "andi %[color], 0x3F\n\t"        // 1
+        "out %[port], %[color]\n\t"      // 1
+        "out %[clk], %[mask]\n\t"        // 1
+        "out %[clk], %[mask]\n\t"        // 1
+        // pixel 2: bits 4-7 of byte 1 and 0-1 of byte 2, nibble swapped
+        "swap %[second]\n\t"             // 1
+        "andi %[second], 0x0F\n\t"       // 1
+        "mov %[color], %[third]\n\t"     // 1
+        "swap %[color]\n\t"              // 1
+        "andi %[color], 0x30\n\t"        // 1
+        "or %[color], %[second]\n\t"     // 1
+        "out %[port], %[color]\n\t"      // 1
+        "out %[clk], %[mask]\n\t"        // 1
+        "out %[clk], %[mask]\n\t"        // 1
+        // pixel 3: bits 2-7 of byte 2
+        "lsr %[third]\n\t"               // 1
+        "lsr %[third]\n\t"               // 1
+        "out %[port], %[third]\n\t"      // 1
+        "out %[clk], %[mask]\n\t"        // 1
+        "out %[clk], %[mask]\n\t"        // 1
+        ".endr\n\t"
+        : [pixels] "+x"(pixels), [first] "=&d"(first), [second] "=&d"(second), [third] "=&d"(third), [color] "=&d"(color)
+        : [groups] "n"(PANEL_X / 4), [port] "I"(_SFR_IO_ADDR(PANEL_ASM_COLOR_PORT)), [clk] "I"(_SFR_IO_ADDR(PANEL_ASM_CLK_TOGGLE)), [mask] "r"(clock_mask)
+        : "memory");
+#endif
+}
+
+#endif
+#endif // HUB75NANO_1BIT_BUFFER_ASM_H
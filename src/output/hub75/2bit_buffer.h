@@ -5,6 +5,55 @@
 #include "../../buffer_setting/buffer_common.h"
 #include "../../Settings.h"
 
+#if PANEL_CANVAS_X > PANEL_X
+// the first view_shift pixels of the LED after the row, they push the pixels before the viewport out of the row again
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+_shiftBigViewTailMsb(const LED *index)
+{
+    if (view_shift > 0)
+    {
+        _set_color((uint8_t)((*((uint16_t *)(index)) >> (uint8_t)6)) & 63);
+        Clock;
+    }
+    if (view_shift > 1)
+    {
+        _set_color((*(((uint8_t *)(index)) + (sizeof(uint8_t) * 2))) >> (uint8_t)2);
+        Clock;
+    }
+    if (view_shift > 2)
+    {
+        _set_color((uint8_t)((*((uint16_t *)(((uint8_t *)(index)) + (sizeof(uint8_t) * 3)))) >> (uint8_t)6) & 63);
+        Clock;
+    }
+}
+
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+_shiftBigViewTailLsb(const LED *index)
+{
+    if (view_shift > 0)
+    {
+        _set_color((*(uint8_t *)(index)) & 63);
+        Clock;
+    }
+    if (view_shift > 1)
+    {
+        _set_color((uint8_t)((*((uint16_t *)(((uint8_t *)(index)) + sizeof(uint8_t)))) >> (uint8_t)4) & 63);
+        Clock;
+    }
+    if (view_shift > 2)
+    {
+        _set_color((*(((uint8_t *)(index)) + (sizeof(uint8_t) * 3))) & 63);
+        Clock;
+    }
+}
+#endif
+
 void _displayBigBuffer()
 {
     LED *index;
@@ -18,17 +67,21 @@ void _displayBigBuffer()
 
     for (uint8_t y = 0; y < PANEL_Y / 2; y++) // 16 rows
     {
+#if PANEL_CANVAS_X > PANEL_X
+        index = (LED *)(&buffer) + _bufferRow(y) * (PANEL_CANVAS_X / 4) + view_led;
+#else
 #if PANEL_Y > 32
-        index = (LED *)(&buffer) + (y << (uint8_t)5);
+        index = (LED *)(&buffer) + (_bufferRow(y) << (uint8_t)5);
 #else
 #if PANEL_Y > 16
-        index = (LED *)(&buffer) + (y << (uint8_t)4);
+        index = (LED *)(&buffer) + (_bufferRow(y) << (uint8_t)4);
 #else
 #if PANEL_Y > 8
-        index = (LED *)(&buffer) + (y << (uint8_t)3);
+        index = (LED *)(&buffer) + (_bufferRow(y) << (uint8_t)3);
 #else
 #if PANEL_Y > 4
-        index = (LED *)(&buffer) + (y << (uint8_t)2);
+        index = (LED *)(&buffer) + (_bufferRow(y) << (uint8_t)2);
+#endif
 #endif
 #endif
 #endif
@@ -186,15 +239,24 @@ void _displayBigBuffer()
         Clock;
         _set_color((*(((uint8_t *)(index)) + (sizeof(uint8_t) * 5))) >> (uint8_t)2);
         Clock;
+#endif
+#if PANEL_CANVAS_X > PANEL_X
+        _shiftBigViewTailMsb(index + 1);
 #endif
         // display _row
+        PANEL_STATS_OE_OFF;
         HIGH_OE;
         LATCH;
         _stepRow();
         CLEAR_OE;
+        PANEL_STATS_ROW;
+        PANEL_STATS_OE_ON;
+        // the row is lit while the serial input is taken in, only in the longer msb pass so the lsb keeps its share
+        PANEL_SERIAL_ROW;
 
 #if MAX_FRAMETIME > 0
         delayMicroseconds(MAX_FRAMETIME);
+        PANEL_STATS_OE_OFF;
         HIGH_OE;
         delayMicroseconds(MAX_FRAMETIME);
 #endif
@@ -203,17 +265,21 @@ void _displayBigBuffer()
     for (uint8_t y = 0; y < PANEL_Y / 2; y++)
     {
 
+#if PANEL_CANVAS_X > PANEL_X
+        index = (LED *)(&buffer) + _bufferRow(y) * (PANEL_CANVAS_X / 4) + view_led;
+#else
 #if PANEL_Y > 32
-        index = (LED *)(&buffer) + (y << (uint8_t)5);
+        index = (LED *)(&buffer) + (_bufferRow(y) << (uint8_t)5);
 #else
 #if PANEL_Y > 16
-        index = (LED *)(&buffer) + (y << (uint8_t)4);
+        index = (LED *)(&buffer) + (_bufferRow(y) << (uint8_t)4);
 #else
 #if PANEL_Y > 8
-        index = (LED *)(&buffer) + (y << (uint8_t)3);
+        index = (LED *)(&buffer) + (_bufferRow(y) << (uint8_t)3);
 #else
 #if PANEL_Y > 4
-        index = (LED *)(&buffer) + (y << (uint8_t)2);
+        index = (LED *)(&buffer) + (_bufferRow(y) << (uint8_t)2);
+#endif
 #endif
 #endif
 #endif
@@ -372,19 +438,27 @@ void _displayBigBuffer()
         Clock;
         _set_color((uint8_t)((*((uint16_t *)(((uint8_t *)(index)) + (sizeof(uint8_t) * 4)))) >> (uint8_t)4) & 63);
         Clock;
+#endif
+#if PANEL_CANVAS_X > PANEL_X
+        _shiftBigViewTailLsb(index + 1);
 #endif
         // display _row
+        PANEL_STATS_OE_OFF;
         HIGH_OE;
         LATCH;
         _stepRow();
         CLEAR_OE;
+        PANEL_STATS_ROW;
+        PANEL_STATS_OE_ON;
 
 #if MAX_FRAMETIME > 0
         delayMicroseconds(MAX_FRAMETIME >> (1));
+        PANEL_STATS_OE_OFF;
         HIGH_OE;
         delayMicroseconds(MAX_FRAMETIME >> (1));
 #endif
     }
+    PANEL_STATS_OE_OFF;
     HIGH_OE;
 }
 
@@ -3,7 +3,11 @@
 
 #ifdef PANEL_FLASH
 
+#ifdef PANEL_HOST
+#include "../../boards/host/host_arduino.h"
+#else
 #include <Arduino.h>
+#endif
 #include "../../buffer_setting/buffer_common.h"
 #include "../../Settings.h"
 
@@ -183,12 +187,16 @@ void _displayFlashBuffer()
         Clock;
 #endif
         // shift data into buffers
+        PANEL_STATS_OE_OFF;
         HIGH_OE;
         LATCH;
         _stepRow();
         CLEAR_OE;
+        PANEL_STATS_ROW;
+        PANEL_STATS_OE_ON;
 #if MAX_FRAMETIME > 0
         delayMicroseconds(MAX_FRAMETIME);
+        PANEL_STATS_OE_OFF;
         HIGH_OE;
         delayMicroseconds(MAX_FRAMETIME);
 #endif
@@ -360,12 +368,16 @@ void _displayFlashBuffer()
         Clock;
 #endif
         // shift data into buffers
+        PANEL_STATS_OE_OFF;
         HIGH_OE;
         LATCH;
         _stepRow();
         CLEAR_OE;
+        PANEL_STATS_ROW;
+        PANEL_STATS_OE_ON;
 #if MAX_FRAMETIME > 0
         delayMicroseconds(MAX_FRAMETIME >> (1));
+        PANEL_STATS_OE_OFF;
         HIGH_OE;
         delayMicroseconds(MAX_FRAMETIME >> (1));
 #endif
@@ -536,12 +548,16 @@ void _displayFlashBuffer()
         Clock;
 #endif
         // shift data into buffers
+        PANEL_STATS_OE_OFF;
         HIGH_OE;
         LATCH;
         _stepRow();
         CLEAR_OE;
+        PANEL_STATS_ROW;
+        PANEL_STATS_OE_ON;
 #if MAX_FRAMETIME > 0
         delayMicroseconds(MAX_FRAMETIME >> (2));
+        PANEL_STATS_OE_OFF;
         HIGH_OE;
         delayMicroseconds(MAX_FRAMETIME >> (2));
 #endif
@@ -713,12 +729,16 @@ void _displayFlashBuffer()
         Clock;
 #endif
         // shift data into buffers
+        PANEL_STATS_OE_OFF;
         HIGH_OE;
         LATCH;
         _stepRow();
         CLEAR_OE;
+        PANEL_STATS_ROW;
+        PANEL_STATS_OE_ON;
 #if MAX_FRAMETIME > 0
         delayMicroseconds(MAX_FRAMETIME >> (3));
+        PANEL_STATS_OE_OFF;
         HIGH_OE;
         delayMicroseconds(MAX_FRAMETIME >> (3));
 #endif
@@ -0,0 +1,103 @@
+#ifndef HUB75NANO_FLASH_OVERLAY_BUFFER_H
+#define HUB75NANO_FLASH_OVERLAY_BUFFER_H
+
+#ifdef PANEL_FLASH_OVERLAY
+
+#ifdef PANEL_HOST
+#include "../../boards/host/host_arduino.h"
+#else
+#include <Arduino.h>
+#endif
+#include "../../buffer_setting/buffer_common.h"
+#include "../../Settings.h"
+
+typedef const uint8_t *buffer_t;
+
+// the flash byte of one pixel with the overlay color in the halves whose overlay bit is set
+// bit is the pixel in the current overlay byte, counted from the side the row is shifted out from
+#ifdef PANEL_FLIP_HORIZONTAL
+#define OVERLAY_BIT(bit) (uint8_t)(0x80 >> (bit))
+#define OVERLAY_MOVE index--
+#else
+#define OVERLAY_BIT(bit) (uint8_t)(1 << (bit))
+#define OVERLAY_MOVE index++
+#endif
+#define OVERLAY_PIXEL(bit)                                \
+    color = pgm_read_byte(OVERLAY_MOVE);                  \
+    if (upper & OVERLAY_BIT(bit))                         \
+    {                                                     \
+        color = (color & (uint8_t)0b111000) | color_upper; \
+    }                                                     \
+    if (lower & OVERLAY_BIT(bit))                         \
+    {                                                     \
+        color = (color & (uint8_t)0b000111) | color_lower; \
+    }                                                     \
+    _set_color(color);                                    \
+    Clock
+
+// one pass over all rows for one bit of color depth, the first plane is the most significant bit
+__attribute__((always_inline)) inline void _displayFlashOverlayPlane(uint8_t plane)
+{
+    const uint8_t color_upper = overlay_planes[plane];
+    const uint8_t color_lower = color_upper << 3;
+#ifndef PANEL_FLIP_VERTICAL
+    for (uint8_t y = 0; y < PANEL_Y / 2; y++) // 32 rows
+#else
+    for (int8_t y = (PANEL_Y / 2) - 1; y >= 0; y--) // 32 rows
+#endif
+    {
+        buffer_t index = (buffer_t)buffer + plane * (PANEL_BUFFERSIZE / 4) + y * PANEL_X;
+        const uint8_t *upper_row = &overlay[y * (PANEL_X / 8)];
+        const uint8_t *lower_row = &overlay[(y + PANEL_Y / 2) * (PANEL_X / 8)];
+#ifdef PANEL_FLIP_HORIZONTAL
+        index += PANEL_X - 1;
+#endif
+        for (uint8_t group = 0; group < PANEL_X / 8; group++)
+        {
+            // 8 pixels share the overlay bytes
+#ifdef PANEL_FLIP_HORIZONTAL
+            const uint8_t upper = upper_row[(PANEL_X / 8) - 1 - group];
+            const uint8_t lower = lower_row[(PANEL_X / 8) - 1 - group];
+#else
+            const uint8_t upper = upper_row[group];
+            const uint8_t lower = lower_row[group];
+#endif
+            uint8_t color;
+            OVERLAY_PIXEL(0);
+            OVERLAY_PIXEL(1);
+            OVERLAY_PIXEL(2);
+            OVERLAY_PIXEL(3);
+            OVERLAY_PIXEL(4);
+            OVERLAY_PIXEL(5);
+            OVERLAY_PIXEL(6);
+            OVERLAY_PIXEL(7);
+        }
+        // shift data into buffers
+        PANEL_STATS_OE_OFF;
+        HIGH_OE;
+        LATCH;
+        _stepRow();
+        CLEAR_OE;
+        PANEL_STATS_ROW;
+        PANEL_STATS_OE_ON;
+#if MAX_FRAMETIME > 0
+        delayMicroseconds(MAX_FRAMETIME >> plane);
+        PANEL_STATS_OE_OFF;
+        HIGH_OE;
+        delayMicroseconds(MAX_FRAMETIME >> plane);
+#endif
+    }
+}
+
+// the 4 bit flash image with the overlay merged in while shifting, same passes as _displayFlashBuffer
+void _displayFlashOverlayBuffer()
+{
+    _displayFlashOverlayPlane(0);
+    _displayFlashOverlayPlane(1);
+    _displayFlashOverlayPlane(2);
+    _displayFlashOverlayPlane(3);
+}
+
+#endif
+
+#endif // HUB75NANO_FLASH_OVERLAY_BUFFER_H
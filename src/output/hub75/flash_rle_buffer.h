@@ -0,0 +1,107 @@
+#ifndef HUB75NANO_FLASH_RLE_BUFFER_H
+#define HUB75NANO_FLASH_RLE_BUFFER_H
+
+#ifdef PANEL_FLASH_RLE
+
+#ifdef PANEL_HOST
+#include "../../boards/host/host_arduino.h"
+#else
+#include <Arduino.h>
+#endif
+#include "../../buffer_setting/buffer_common.h"
+#include "../../Settings.h"
+
+// the image starts with a 16 bit offset (from the start of the image) for every row of every pass, 4 * PANEL_Y / 2 of them
+// the rows follow as tokens: below 64 one pixel of that value, from 64 on a run of token - 62 pixels of the value in the next byte
+// runs end with their row, so a row is never more than PANEL_X tokens and any row can be found without decoding the ones before it
+#define RLE_RUN 64
+#define RLE_RUN_BIAS 62
+
+// the tokens of the row for one pass, runs set the color once and only clock
+__attribute__((always_inline)) inline void _displayFlashRlePlane(uint8_t plane)
+{
+    const uint16_t *offsets = (const uint16_t *)buffer + plane * (PANEL_Y / 2);
+#ifndef PANEL_FLIP_VERTICAL
+    for (uint8_t y = 0; y < PANEL_Y / 2; y++) // 32 rows
+#else
+    for (int8_t y = (PANEL_Y / 2) - 1; y >= 0; y--) // 32 rows
+#endif
+    {
+        const uint8_t *index = (const uint8_t *)buffer + pgm_read_word(&offsets[y]);
+#ifdef PANEL_FLIP_HORIZONTAL
+        // collect the row, then shift it out from its end
+        uint8_t x = 0;
+        while (x < PANEL_X)
+        {
+            const uint8_t token = pgm_read_byte(index++);
+            if (token < RLE_RUN)
+            {
+                rle_row[x++] = token;
+            }
+            else
+            {
+                const uint8_t value = pgm_read_byte(index++);
+                for (uint8_t count = token - RLE_RUN_BIAS; count > 0; count--)
+                {
+                    rle_row[x++] = value;
+                }
+            }
+        }
+        while (x > 0)
+        {
+            _set_color(rle_row[--x]);
+            Clock;
+        }
+#else
+        uint8_t x = 0;
+        while (x < PANEL_X)
+        {
+            const uint8_t token = pgm_read_byte(index++);
+            if (token < RLE_RUN)
+            {
+                _set_color(token);
+                Clock;
+                x++;
+            }
+            else
+            {
+                // the color pins keep the value while the run is clocked in
+                uint8_t count = token - RLE_RUN_BIAS;
+                _set_color(pgm_read_byte(index++));
+                x += count;
+                do
+                {
+                    Clock;
+                } while (--count);
+            }
+        }
+#endif
+        // shift data into buffers
+        PANEL_STATS_OE_OFF;
+        HIGH_OE;
+        LATCH;
+        _stepRow();
+        CLEAR_OE;
+        PANEL_STATS_ROW;
+        PANEL_STATS_OE_ON;
+#if MAX_FRAMETIME > 0
+        delayMicroseconds(MAX_FRAMETIME >> plane);
+        PANEL_STATS_OE_OFF;
+        HIGH_OE;
+        delayMicroseconds(MAX_FRAMETIME >> plane);
+#endif
+    }
+}
+
+// the 4 passes of the flash buffer, decoded row by row while shifting, the first plane is the most significant bit
+void _displayFlashRleBuffer()
+{
+    _displayFlashRlePlane(0);
+    _displayFlashRlePlane(1);
+    _displayFlashRlePlane(2);
+    _displayFlashRlePlane(3);
+}
+
+#endif
+
+#endif // HUB75NANO_FLASH_RLE_BUFFER_H
@@ -5,15 +5,27 @@
 #include "2bit_buffer.h"
 #else
 #ifdef PANEL_FLASH
+#ifdef PANEL_FLASH_OVERLAY
+#include "flash_overlay_buffer.h"
+#else
+#ifdef PANEL_FLASH_RLE
+#include "flash_rle_buffer.h"
+#else
 #include "flash_buffer.h"
+#endif
+#endif
 #else
 #ifdef PANEL_NO_BUFFER
 #include "immediate_color.h"
 #else
+#ifdef PANEL_PALETTE
+#include "palette_buffer.h"
+#else
 #include "1bit_buffer.h"
 #endif
 #endif
 #endif
+#endif
 
 #ifndef PANEL_NO_BUFFER
 #ifdef PANEL_MAX_SPEED
@@ -23,15 +35,35 @@ inline void
 displayBuffer()
 {
     // puts the  buffer contents onto the panel
+    PANEL_STATS_FRAME_BEGIN;
+#ifdef PANEL_SERIAL_STREAM
+    _swapStream(); // a finished frame from the stream shows from this refresh on
+#endif
 #ifdef PANEL_BIG
     _displayBigBuffer(); // 1 bit buffer in ram
 #else
 #ifdef PANEL_FLASH
+#ifdef PANEL_FLASH_OVERLAY
+    _displayFlashOverlayBuffer(); // 4 bit buffer in flash with the 1 bit overlay in ram
+#else
+#ifdef PANEL_FLASH_RLE
+    _displayFlashRleBuffer(); // run length encoded 4 bit buffer in flash
+#else
     _displayFlashBuffer(); // 4 bit buffer in flash
+#endif
+#endif
+#else
+#ifdef PANEL_PALETTE
+    _displayPaletteBuffer(); // 2 bit indices in ram with a 4 bit palette
 #else
     _displaySmallBuffer(); // 2 bit buffer in ram
 #endif
 #endif
+#endif
+#ifdef PANEL_FLASH
+    _advanceAnimation(); // the next frame shows from the next refresh on
+#endif
+    PANEL_STATS_FRAME_END;
 }
 #endif
 
@@ -0,0 +1,70 @@
+#ifndef HUB75NANO_PALETTE_BUFFER_H
+#define HUB75NANO_PALETTE_BUFFER_H
+
+#ifdef PANEL_PALETTE
+
+#ifdef PANEL_HOST
+#include "../../boards/host/host_arduino.h"
+#else
+#include <Arduino.h>
+#endif
+#include "../../buffer_setting/buffer_common.h"
+#include "../../Settings.h"
+
+// two pixels from one byte, the nibble of each is looked up in the table of the current pass
+#define PALETTE_PIXELS                          \
+    pixels = *index++;                          \
+    _set_color(lut[pixels & (uint8_t)0b1111]); \
+    Clock;                                      \
+    _set_color(lut[pixels >> 4]);               \
+    Clock
+
+// one pass over all rows for one bit of color depth, the first plane is the most significant bit
+__attribute__((always_inline)) inline void _displayPalettePlane(uint8_t plane)
+{
+    const uint8_t *lut = palette_planes[plane];
+    for (uint8_t y = 0; y < PANEL_Y / 2; y++) // 32 rows
+    {
+        const uint8_t *index = &buffer[(uint16_t)_bufferRow(y) * (PANEL_X / 2)];
+        uint8_t pixels;
+        for (uint8_t group = 0; group < PANEL_X / 8; group++)
+        {
+            PALETTE_PIXELS;
+            PALETTE_PIXELS;
+            PALETTE_PIXELS;
+            PALETTE_PIXELS;
+        }
+        // shift data into buffers
+        PANEL_STATS_OE_OFF;
+        HIGH_OE;
+        LATCH;
+        _stepRow();
+        CLEAR_OE;
+        PANEL_STATS_ROW;
+        PANEL_STATS_OE_ON;
+#if MAX_FRAMETIME > 0
+        delayMicroseconds(MAX_FRAMETIME >> plane);
+        PANEL_STATS_OE_OFF;
+        HIGH_OE;
+        delayMicroseconds(MAX_FRAMETIME >> plane);
+#endif
+    }
+}
+
+// the 4 passes of the flash buffer, with the colors coming from the palette instead of the image
+// a changed palette is expanded into the pass tables once, before the frame starts
+void _displayPaletteBuffer()
+{
+    if (palette_changed)
+    {
+        _buildPalettePlanes();
+    }
+    _displayPalettePlane(0);
+    _displayPalettePlane(1);
+    _displayPalettePlane(2);
+    _displayPalettePlane(3);
+}
+
+#endif
+
+#endif // HUB75NANO_PALETTE_BUFFER_H
@@ -52,8 +52,18 @@ void _displaySmallBuffer()
     for (uint8_t y = 0; y < PANEL_E_Y / 2; y++) // 32 rows
     {
         _stepRow();
-
-        index = (LED *)(&buffer) + ((y & (uint8_t)~1) << (uint8_t)3); // advance over last row
+        PANEL_STATS_ROW;
+
+#ifdef PANEL_TEXT_MODE
+        // two panel rows show the same buffer row, it is only rendered for the first
+        if ((y & 1) == 0)
+        {
+            _renderTextRow(y >> 1);
+        }
+        index = (LED *)(&buffer);
+#else
+        index = (LED *)(&buffer) + (_bufferRow(y >> 1) << (uint8_t)4); // advance over last row
+#endif
 
         // we integer divide the screen by 2 and then set 16 led to 8 values in pairs
 
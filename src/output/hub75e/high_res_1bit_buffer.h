@@ -11,9 +11,10 @@ void _displaySmallHighResBuffer()
     {
 #ifndef PANEL_SMALL_BRIGHT
         _stepRow();
+        PANEL_STATS_ROW;
 #endif
 
-        index = (LED *)(&buffer) + (y << (uint8_t)4); // advance over last row
+        index = (LED *)(&buffer) + (_bufferRow(y) << (uint8_t)4); // advance over last row
 
         // chip 0
         _set_color(0);
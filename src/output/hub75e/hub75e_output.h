@@ -23,6 +23,7 @@ inline void
 displayBuffer()
 {
     // puts the  buffer contents onto the panel
+    PANEL_STATS_FRAME_BEGIN;
 #ifdef PANEL_BIG
     _displayBigBuffer(); // 2 bit buffer in ram
 #else
@@ -32,6 +33,10 @@ displayBuffer()
     _displaySmallBuffer(); // 1 bit buffer in ram
 #endif
 #endif
+#ifdef PANEL_FLASH
+    _advanceAnimation(); // the next frame shows from the next refresh on
+#endif
+    PANEL_STATS_FRAME_END;
 }
 
 #endif
@@ -1,6 +1,10 @@
 #ifndef HUB75NANO_OUTPUT_H
 #define HUB75NANO_OUTPUT_H
 
+#include "stats.h"
+#include "serial_input.h"
+#include "text_row.h"
+
 // change output panel type here once merged
 #ifdef PANEL_HUB75E
 #include "hub75e/hub75e_output.h"
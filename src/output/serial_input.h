@@ -0,0 +1,187 @@
+#ifndef HUB75NANO_SERIAL_INPUT_H
+#define HUB75NANO_SERIAL_INPUT_H
+
+#include "../Settings.h"
+
+// binary rectangle updates over serial, only compiled in with PANEL_SERIAL_INPUT, PANEL_SERIAL_ROW is empty otherwise
+// a packet is PANEL_SERIAL_SYNC, PANEL_SERIAL_RECT, x, y, w, h and then w * h LED structs, row after row
+// x and w count LED structs (4 columns), y and h buffer rows (row y of the upper half and y + PANEL_Y / 2 of the lower one)
+// the structs are copied into the buffer as they are, so the sender packs them like setBuffer() would, flips included
+// y counts from the first row shown like setBuffer() does, the parts outside of the buffer are read and dropped
+// with PANEL_SERIAL_STREAM a packet can also be PANEL_SERIAL_SYNC, PANEL_SERIAL_FRAME and then the whole buffer, which goes into
+// the second buffer and is shown from the next refresh on, no more bytes are taken in until then
+// flow control: after every PANEL_SERIAL_ACK_EVERY bytes taken in the panel sends PANEL_SERIAL_ACK, and the sender never
+// has more than PANEL_SERIAL_WINDOW bytes unacknowledged, so the 64 byte receive buffer of the avr core cannot overflow
+#define PANEL_SERIAL_SYNC 0xA5
+#define PANEL_SERIAL_RECT 'R'
+#define PANEL_SERIAL_FRAME 'F'
+#define PANEL_SERIAL_ACK 0x06
+#define PANEL_SERIAL_ACK_EVERY 16
+#define PANEL_SERIAL_WINDOW 48
+
+#ifdef PANEL_SERIAL_INPUT
+#define SERIAL_WAIT_SYNC 0
+#define SERIAL_WAIT_COMMAND 1
+#define SERIAL_HEADER 2
+#define SERIAL_DATA 3
+#define SERIAL_FRAME 4
+
+uint8_t serial_state = SERIAL_WAIT_SYNC;
+// x, y, w, h of the rectangle that is coming in
+uint8_t serial_header[4];
+uint8_t serial_header_length = 0;
+// the row of the rectangle and the byte in it the next data byte goes to
+uint8_t serial_line = 0;
+uint16_t serial_column = 0;
+// bytes per row of the rectangle, and how many of them fit into the buffer
+uint16_t serial_row_bytes = 0;
+uint16_t serial_row_fits = 0;
+// the first byte of the rectangle in the buffer row of serial_line, 0 if that row is outside
+uint8_t *serial_target = 0;
+uint8_t serial_unacked = 0;
+
+#ifdef PANEL_SERIAL_STREAM
+// the output shows front_buffer while the stream fills back_buffer, a finished frame swaps the two pointers
+LED stream_buffer[PANEL_BUFFERSIZE];
+LED *front_buffer = buffer;
+LED *back_buffer = stream_buffer;
+bool stream_ready = false;
+// frames shown since the start, wraps around
+uint16_t streamed_frames = 0;
+
+// shows the frame the stream finished, called before a refresh so no refresh mixes two frames
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+_swapStream()
+{
+    if (!stream_ready)
+    {
+        return;
+    }
+    LED *shown = back_buffer;
+    back_buffer = front_buffer;
+    front_buffer = shown;
+    // the frame starts at the first row
+    row_origin = 0;
+    streamed_frames++;
+    stream_ready = false;
+}
+#endif
+
+// points serial_target at the buffer row of serial_line
+void _serialStartLine()
+{
+    const uint8_t y = serial_header[1] + serial_line;
+    serial_target = 0;
+    if (y < serial_header[1] || y >= (PANEL_Y / 2) || serial_row_fits == 0)
+    {
+        return;
+    }
+    // rectangles change the frame that is shown
+    serial_target = (uint8_t *)&PANEL_SHOWN_BUFFER[(uint16_t)_bufferRow(y) * (PANEL_CANVAS_X / 4) + serial_header[0]];
+}
+
+void _serialByte(uint8_t value)
+{
+    switch (serial_state)
+    {
+    case SERIAL_WAIT_SYNC:
+        if (value == PANEL_SERIAL_SYNC)
+        {
+            serial_state = SERIAL_WAIT_COMMAND;
+        }
+        break;
+    case SERIAL_WAIT_COMMAND:
+        // anything else is taken as noise, the parser waits for the next sync
+        serial_state = value == PANEL_SERIAL_RECT ? SERIAL_HEADER : SERIAL_WAIT_SYNC;
+        serial_header_length = 0;
+#ifdef PANEL_SERIAL_STREAM
+        if (value == PANEL_SERIAL_FRAME)
+        {
+            serial_state = SERIAL_FRAME;
+            serial_column = 0;
+        }
+#endif
+        break;
+#ifdef PANEL_SERIAL_STREAM
+    case SERIAL_FRAME:
+        // serial_column counts the bytes of the frame
+        ((uint8_t *)back_buffer)[serial_column++] = value;
+        if (serial_column == sizeof(buffer))
+        {
+            stream_ready = true;
+            serial_state = SERIAL_WAIT_SYNC;
+        }
+        break;
+#endif
+    case SERIAL_HEADER:
+        serial_header[serial_header_length++] = value;
+        if (serial_header_length == 4)
+        {
+            const uint8_t x = serial_header[0], w = serial_header[2];
+            serial_row_bytes = (uint16_t)w * sizeof(LED);
+            serial_row_fits = x >= (PANEL_CANVAS_X / 4) ? 0 : (uint16_t)min(w, (uint8_t)((PANEL_CANVAS_X / 4) - x)) * sizeof(LED);
+            serial_line = 0;
+            serial_column = 0;
+            _serialStartLine();
+            serial_state = serial_row_bytes != 0 && serial_header[3] != 0 ? SERIAL_DATA : SERIAL_WAIT_SYNC;
+        }
+        break;
+    default:
+        if (serial_target != 0 && serial_column < serial_row_fits)
+        {
+            serial_target[serial_column] = value;
+        }
+        if (++serial_column == serial_row_bytes)
+        {
+            serial_column = 0;
+            if (++serial_line == serial_header[3])
+            {
+                serial_state = SERIAL_WAIT_SYNC;
+            }
+            else
+            {
+                _serialStartLine();
+            }
+        }
+        break;
+    }
+}
+
+// takes in at most max of the bytes that arrived and acknowledges them
+void _serialRead(uint8_t max)
+{
+#ifdef PANEL_SERIAL_STREAM
+    // a finished frame waits for the next refresh, the bytes after it stay in the receive buffer
+    while (max-- > 0 && !stream_ready && PANEL_SERIAL_PORT.available() > 0)
+#else
+    while (max-- > 0 && PANEL_SERIAL_PORT.available() > 0)
+#endif
+    {
+        _serialByte((uint8_t)PANEL_SERIAL_PORT.read());
+        if (++serial_unacked == PANEL_SERIAL_ACK_EVERY)
+        {
+            serial_unacked = 0;
+            PANEL_SERIAL_PORT.write((uint8_t)PANEL_SERIAL_ACK);
+        }
+    }
+}
+
+// takes in everything that arrived, for times the sketch does not call displayBuffer()
+#ifdef PANEL_MAX_SPEED
+__attribute__((always_inline))
+#endif
+inline void
+readSerialInput()
+{
+    _serialRead(255);
+}
+
+#define PANEL_SERIAL_ROW _serialRead(PANEL_SERIAL_BYTES_PER_ROW)
+#else
+#define PANEL_SERIAL_ROW
+#endif
+
+#endif // HUB75NANO_SERIAL_INPUT_H
@@ -0,0 +1,99 @@
+#ifndef HUB75NANO_STATS_H
+#define HUB75NANO_STATS_H
+
+#include "../Settings.h"
+
+// refresh statistics, only compiled in with PANEL_STATS, the macros below are empty otherwise
+// every hook costs a micros() call (about 4us on a 16MHz avr), so the output gets a bit slower when enabled
+#ifdef PANEL_STATS
+#ifdef PANEL_NO_BUFFER
+#pragma GCC warning "PANEL_STATS needs displayBuffer(), there are no statistics in immediate mode"
+#undef PANEL_STATS
+#endif
+#endif
+
+#ifdef PANEL_STATS
+#include "../structs/PanelStats.h"
+
+PanelStats _stats;
+uint32_t _stats_frame_start = 0;
+uint32_t _stats_frame_end = 0;
+uint32_t _stats_row_start = 0;
+uint32_t _stats_oe_since = 0;
+bool _stats_oe_on = false;
+
+const PanelStats &stats() const
+{
+    return _stats;
+}
+
+void resetStats()
+{
+    _stats = PanelStats();
+    _stats_frame_end = 0;
+}
+
+void _statsFrameBegin()
+{
+    _stats_frame_start = micros();
+    _stats_row_start = _stats_frame_start;
+    if (_stats_frame_end)
+        _stats.between_frames += _stats_frame_start - _stats_frame_end;
+}
+
+void _statsFrameEnd()
+{
+    _statsOutputOff();
+    _stats_frame_end = micros();
+    const uint32_t frame_time = _stats_frame_end - _stats_frame_start;
+    _stats.frames++;
+    _stats.output_time += frame_time;
+    _stats.frame_min = min(_stats.frame_min, frame_time);
+    _stats.frame_max = max(_stats.frame_max, frame_time);
+}
+
+// called once per row after the row select, files the time since the last one
+void _statsRow()
+{
+    const uint32_t now = micros();
+    uint32_t row_time = (now - _stats_row_start) >> 4;
+    _stats_row_start = now;
+    uint8_t bin = 0;
+    while (row_time && bin < PANEL_STATS_BINS - 1)
+    {
+        row_time >>= 1;
+        bin++;
+    }
+    _stats.rows[bin]++;
+}
+
+void _statsOutputOn()
+{
+    if (_stats_oe_on)
+        return;
+    _stats_oe_since = micros();
+    _stats_oe_on = true;
+}
+
+void _statsOutputOff()
+{
+    if (!_stats_oe_on)
+        return;
+    _stats.oe_on_time += micros() - _stats_oe_since;
+    _stats_oe_on = false;
+}
+
+#define PANEL_STATS_FRAME_BEGIN _statsFrameBegin()
+#define PANEL_STATS_FRAME_END _statsFrameEnd()
+#define PANEL_STATS_ROW _statsRow()
+#define PANEL_STATS_OE_ON _statsOutputOn()
+#define PANEL_STATS_OE_OFF _statsOutputOff()
+#else
+#define PANEL_STATS_FRAME_BEGIN
+#define PANEL_STATS_FRAME_END
+#define PANEL_STATS_ROW
+#define PANEL_STATS_OE_ON
+#define PANEL_STATS_OE_OFF
+#endif
+
+#endif // HUB75NANO_STATS_H
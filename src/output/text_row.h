@@ -0,0 +1,71 @@
+#ifndef HUB75NANO_TEXT_ROW_H
+#define HUB75NANO_TEXT_ROW_H
+
+#ifdef PANEL_TEXT_MODE
+#include "../buffer_setting/buffer_common.h"
+#include "../Settings.h"
+
+// one pixel of both halves, upper rgb in bits 0-2 and lower rgb in bits 3-5 like the LED structs
+// mask is the tile bit of the pixel, counted from the side the row is shifted out from
+#define TEXT_PIXEL(mask) (uint8_t)(((upper & (mask)) ? upper_fg : upper_bg) | ((lower & (mask)) ? lower_fg : lower_bg))
+#ifdef PANEL_FLIP_HORIZONTAL
+#define TEXT_MASK(pixel) (uint8_t)(1 << (pixel))
+#else
+#define TEXT_MASK(pixel) (uint8_t)(8 >> (pixel))
+#endif
+
+// renders buffer row y (row y of the upper half and y + PANEL_Y / 2 of the lower one) from the cells into buffer
+// a tile is 4 pixels wide, so every cell is exactly one LED_short and the output shifts buffer as usual
+void _renderTextRow(uint8_t y)
+{
+#ifdef PANEL_FLIP_VERTICAL
+    const uint8_t upper_y = PANEL_Y - 1 - y;
+    const uint8_t lower_y = (PANEL_Y / 2) - 1 - y;
+#else
+    const uint8_t upper_y = y;
+    const uint8_t lower_y = y + (PANEL_Y / 2);
+#endif
+    const uint8_t upper_row = upper_y / PANEL_TILE_Y;
+    const uint8_t lower_row = lower_y / PANEL_TILE_Y;
+    const uint8_t *upper_tiles = tileset + (upper_y - upper_row * PANEL_TILE_Y);
+    const uint8_t *lower_tiles = tileset + (lower_y - lower_row * PANEL_TILE_Y);
+    const uint8_t upper_cell = upper_row * PANEL_TEXT_COLS;
+    const uint8_t lower_cell = lower_row * PANEL_TEXT_COLS;
+    uint8_t *out = (uint8_t *)buffer;
+    for (uint8_t i = 0; i < PANEL_TEXT_COLS; i++)
+    {
+#ifdef PANEL_FLIP_HORIZONTAL
+        const uint8_t col = PANEL_TEXT_COLS - 1 - i;
+#else
+        const uint8_t col = i;
+#endif
+        // rows below the last whole cell are black
+        uint8_t upper = 0, upper_colors = 0, lower = 0, lower_colors = 0;
+        if (upper_row < PANEL_TEXT_ROWS)
+        {
+            upper = pgm_read_byte(&upper_tiles[text_cells[upper_cell + col] * PANEL_TILE_Y]);
+            upper_colors = text_colors[upper_cell + col];
+        }
+        if (lower_row < PANEL_TEXT_ROWS)
+        {
+            lower = pgm_read_byte(&lower_tiles[text_cells[lower_cell + col] * PANEL_TILE_Y]);
+            lower_colors = text_colors[lower_cell + col];
+        }
+        const uint8_t upper_fg = upper_colors & (uint8_t)0b000111;
+        const uint8_t upper_bg = upper_colors >> 3;
+        const uint8_t lower_fg = (uint8_t)(lower_colors << 3) & (uint8_t)0b111000;
+        const uint8_t lower_bg = lower_colors & (uint8_t)0b111000;
+        const uint8_t pixel_0 = TEXT_PIXEL(TEXT_MASK(0));
+        const uint8_t pixel_1 = TEXT_PIXEL(TEXT_MASK(1));
+        const uint8_t pixel_2 = TEXT_PIXEL(TEXT_MASK(2));
+        const uint8_t pixel_3 = TEXT_PIXEL(TEXT_MASK(3));
+        // pixel p starts at bit p * 6
+        out[0] = pixel_0 | (uint8_t)(pixel_1 << 6);
+        out[1] = (pixel_1 >> 2) | (uint8_t)(pixel_2 << 4);
+        out[2] = (pixel_2 >> 4) | (uint8_t)(pixel_3 << 2);
+        out += 3;
+    }
+}
+#endif
+
+#endif // HUB75NANO_TEXT_ROW_H
@@ -0,0 +1,19 @@
+#ifndef HUB75NANO_ANIMATION_FRAME_H
+#define HUB75NANO_ANIMATION_FRAME_H
+
+#include <inttypes.h>
+
+#ifndef ARDUINO_ARCH_AVR
+#ifndef PGM_VOID_P
+#define PGM_VOID_P const void *
+#endif
+#endif
+
+// one frame of a flash animation, the frame tables live in PROGMEM next to the images
+typedef struct AnimationFrame
+{
+    PGM_VOID_P image;  // what swapBuffer() would take, a plain or run length encoded flash image
+    uint16_t duration; // milliseconds the frame is shown at least, it changes after the next whole refresh
+} AnimationFrame;
+
+#endif // HUB75NANO_ANIMATION_FRAME_H
@@ -31,6 +31,13 @@ public:
     inline static const Color DARKERYELLOW = COLOR_888_to_444(1, 1, 0);
     inline static const Color DARKERCYAN = COLOR_888_to_444(0, 1, 1);
     inline static const Color ORANGE = COLOR_888_to_444(3, 1, 0);
+#endif
+#ifdef PANEL_PALETTE
+    // the palette mode draws palette indices, the index is the red channel, so BLACK is 0 and WHITE is 3
+    inline static const Color INDEX_0 = COLOR_888_to_444(0, 0, 0);
+    inline static const Color INDEX_1 = COLOR_888_to_444(1, 0, 0);
+    inline static const Color INDEX_2 = COLOR_888_to_444(2, 0, 0);
+    inline static const Color INDEX_3 = COLOR_888_to_444(3, 0, 0);
 #endif
     inline static const Color NO_COLOR = {0, 0, 0, 15};
 
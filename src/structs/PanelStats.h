@@ -0,0 +1,46 @@
+#ifndef HUB75NANO_PANEL_STATS_H
+#define HUB75NANO_PANEL_STATS_H
+
+#include <inttypes.h>
+
+// row time histogram, bin i counts rows that took less than 16us << i, the last bin takes everything longer
+#ifndef PANEL_STATS_BINS
+#define PANEL_STATS_BINS 8
+#endif
+
+// all times in microseconds, counted since the last resetStats()
+typedef struct PanelStats
+{
+    uint32_t frames = 0;
+    uint32_t frame_min = 0xffffffff; // so the first frame is the shortest
+    uint32_t frame_max = 0;
+    uint32_t output_time = 0;    // spent inside displayBuffer()
+    uint32_t between_frames = 0; // spent outside of displayBuffer(), drawing and the rest of the sketch
+    uint32_t oe_on_time = 0;     // leds lit (OE low) while inside displayBuffer(), hub75 only
+    uint32_t rows[PANEL_STATS_BINS] = {};
+
+    uint32_t frameAverage() const
+    {
+        return frames ? output_time / frames : 0;
+    }
+
+    // frames per second displayBuffer() could reach if it ran back to back
+    uint32_t refreshRate() const
+    {
+        return output_time ? (uint32_t)((uint64_t)frames * 1000000UL / output_time) : 0;
+    }
+
+    // in percent of the output time
+    uint8_t oeDuty() const
+    {
+        return output_time ? (uint8_t)((uint64_t)oe_on_time * 100 / output_time) : 0;
+    }
+
+    // in percent of all time, how much of the cpu goes to the panel
+    uint8_t outputShare() const
+    {
+        return (output_time + between_frames) ? (uint8_t)((uint64_t)output_time * 100 / (output_time + between_frames)) : 0;
+    }
+} PanelStats;
+
+#endif // HUB75NANO_PANEL_STATS_H